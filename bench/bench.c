@@ -0,0 +1,431 @@
+/*******************************************************************************
+ * @file  bench.c
+ *
+ * @brief Single-threaded Queue_t microbenchmarks
+ *
+ * @details  Sweeps data size, capacity and access pattern, timing each
+ *           combination over several repeats after a warmup run, and reports
+ *           ns/op and bytes/s. One op is one Queue_Push() or one Queue_Pop().
+ *
+ *           Usage: bench.exe [--format=table|csv|json] [--repeats=N] [--quick]
+ *                            [--baseline=FILE] [--threshold=PCT]
+ *
+ *           --baseline compares median ns/op against a CSV written by an
+ *           earlier run with --format=csv. The comparison is report-only
+ *           unless --threshold is given, in which case the exit status is 1
+ *           if any combination got slower by more than that many percent.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "queue.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+#define BENCH_MAX_REPEATS   32u
+#define BENCH_MAX_RESULTS   256u
+#define BENCH_MAX_BUF_SIZE  (16u * 1024u * 1024u) /* Skip larger combinations */
+#define BENCH_BYTES_PER_RUN (64u * 1024u * 1024u) /* Bytes moved per timed run */
+#define BENCH_MAX_OPS       (1u << 22)
+
+#define ELEMENTS_IN(array)  (sizeof(array) / sizeof((array)[0]))
+
+/*============================================================================*
+ *                              T Y P E D E F S                               *
+ *============================================================================*/
+
+/* Runs roughly ops operations and returns how many it actually ran */
+typedef uint64_t (*Bench_Pattern_f)(Queue_t *pQ, uint8_t *pIn, uint8_t *pOut, uint64_t ops);
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+typedef struct _Bench_Pattern_t
+{
+    const char     *pName;
+    Bench_Pattern_f pfnRun;
+    bool            halfFull; /* Prefill to half capacity so the cursors wrap */
+} Bench_Pattern_t;
+
+typedef struct _Bench_Result_t
+{
+    const char *pPattern;
+    size_t      dataSize;
+    size_t      capacity;
+    uint64_t    ops;
+    double      nsMin;
+    double      nsMedian;
+    double      nsMean;
+    double      nsStddev;
+    double      bytesPerSec;
+    double      nsBaseline; /* NAN if there is no baseline entry */
+} Bench_Result_t;
+
+typedef enum _Bench_Format_e
+{
+    Bench_Format_Table,
+    Bench_Format_Csv,
+    Bench_Format_Json,
+} Bench_Format_e;
+
+/*============================================================================*
+ *                     P R I V A T E    V A R I A B L E S                     *
+ *============================================================================*/
+
+/* Popped bytes are folded in here so the copies cannot be optimized out */
+static volatile uint8_t Bench_Sink;
+
+static Bench_Result_t Bench_Results[BENCH_MAX_RESULTS];
+static size_t Bench_NumResults;
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+static uint64_t Bench_NowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/* Push one, pop one. The queue holds whatever it was prefilled with plus one. */
+static uint64_t Bench_PushPop(Queue_t *pQ, uint8_t *pIn, uint8_t *pOut, uint64_t ops)
+{
+    uint8_t sink = 0;
+    for (uint64_t i = 0; i < ops / 2; i++)
+    {
+        pIn[0] = (uint8_t)i;
+        Queue_Push(pQ, pIn);
+        Queue_Pop(pQ, pOut);
+        sink ^= pOut[0];
+    }
+    Bench_Sink = sink;
+    return ops / 2 * 2;
+}
+
+/* Push until full, then pop until empty, touching the whole buffer */
+static uint64_t Bench_FillDrain(Queue_t *pQ, uint8_t *pIn, uint8_t *pOut, uint64_t ops)
+{
+    uint8_t sink = 0;
+    uint64_t done = 0;
+    while (done < ops)
+    {
+        while (Queue_Push(pQ, pIn) == Queue_Error_None)
+        {
+            pIn[0]++;
+            done++;
+        }
+        while (Queue_Pop(pQ, pOut) == Queue_Error_None)
+        {
+            sink ^= pOut[0];
+            done++;
+        }
+    }
+    Bench_Sink = sink;
+    return done;
+}
+
+static const Bench_Pattern_t Bench_Patterns[] = {
+    { "pingpong",  Bench_PushPop,   false },
+    { "filldrain", Bench_FillDrain, false },
+    { "halffull",  Bench_PushPop,   true  },
+};
+
+static int Bench_CompareDouble(const void *pA, const void *pB)
+{
+    double a = *(const double *)pA;
+    double b = *(const double *)pB;
+    return (a > b) - (a < b);
+}
+
+/* Time one combination: a warmup run, then repeats timed runs */
+static void Bench_Run(const Bench_Pattern_t *pPattern, size_t dataSize, size_t capacity,
+                      uint32_t repeats, Bench_Result_t *pResult)
+{
+    size_t bufSize = dataSize * capacity;
+    uint8_t *pBuf = malloc(bufSize);
+    uint8_t *pIn = calloc(1, dataSize);
+    uint8_t *pOut = calloc(1, dataSize);
+    uint64_t ops = BENCH_BYTES_PER_RUN / dataSize;
+    double ns[BENCH_MAX_REPEATS];
+
+    if (ops > BENCH_MAX_OPS)
+    {
+        ops = BENCH_MAX_OPS;
+    }
+
+    for (uint32_t run = 0; run <= repeats; run++)
+    {
+        Queue_t q;
+        Queue_Init(&q, pBuf, bufSize, dataSize);
+
+        /* Prefill outside the timed region */
+        if (pPattern->halfFull)
+        {
+            for (size_t i = 0; i < capacity / 2; i++)
+            {
+                Queue_Push(&q, pIn);
+            }
+        }
+
+        uint64_t start = Bench_NowNs();
+        uint64_t done = pPattern->pfnRun(&q, pIn, pOut, ops);
+        uint64_t elapsed = Bench_NowNs() - start;
+
+        /* Run 0 is the warmup and is thrown away */
+        if (run > 0)
+        {
+            ns[run - 1] = (double)elapsed / (double)done;
+            pResult->ops = done;
+        }
+    }
+
+    double sum = 0.0;
+    double sumSq = 0.0;
+    for (uint32_t i = 0; i < repeats; i++)
+    {
+        sum += ns[i];
+        sumSq += ns[i] * ns[i];
+    }
+    qsort(ns, repeats, sizeof(ns[0]), Bench_CompareDouble);
+
+    pResult->pPattern = pPattern->pName;
+    pResult->dataSize = dataSize;
+    pResult->capacity = capacity;
+    pResult->nsMin = ns[0];
+    pResult->nsMedian = (repeats % 2) ? ns[repeats / 2] : (ns[repeats / 2 - 1] + ns[repeats / 2]) / 2.0;
+    pResult->nsMean = sum / repeats;
+    pResult->nsStddev = sqrt(fmax(0.0, sumSq / repeats - pResult->nsMean * pResult->nsMean));
+    pResult->bytesPerSec = (double)dataSize * 1e9 / pResult->nsMedian;
+    pResult->nsBaseline = NAN;
+
+    free(pBuf);
+    free(pIn);
+    free(pOut);
+}
+
+/* Attach median ns/op from a CSV written by an earlier run */
+static int Bench_LoadBaseline(const char *pPath)
+{
+    FILE *pFile = fopen(pPath, "r");
+    char line[256];
+
+    if (pFile == NULL)
+    {
+        fprintf(stderr, "bench: cannot open baseline %s\n", pPath);
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), pFile) != NULL)
+    {
+        char pattern[32];
+        size_t dataSize;
+        size_t capacity;
+        double nsMedian;
+
+        if (sscanf(line, "%31[^,],%zu,%zu,%*u,%*f,%lf", pattern, &dataSize, &capacity, &nsMedian) != 4)
+        {
+            continue; /* Header or malformed line */
+        }
+        for (size_t i = 0; i < Bench_NumResults; i++)
+        {
+            Bench_Result_t *pResult = &Bench_Results[i];
+            if (strcmp(pResult->pPattern, pattern) == 0 && pResult->dataSize == dataSize &&
+                pResult->capacity == capacity)
+            {
+                pResult->nsBaseline = nsMedian;
+            }
+        }
+    }
+    fclose(pFile);
+
+    return 0;
+}
+
+/* Percent change in median ns/op against the baseline, positive is slower */
+static double Bench_Delta(const Bench_Result_t *pResult)
+{
+    return (pResult->nsMedian / pResult->nsBaseline - 1.0) * 100.0;
+}
+
+static void Bench_Print(Bench_Format_e format)
+{
+    switch (format)
+    {
+    case Bench_Format_Csv:
+        printf("pattern,data_size,capacity,ops,ns_min,ns_median,ns_mean,ns_stddev,bytes_per_s,delta_pct\n");
+        for (size_t i = 0; i < Bench_NumResults; i++)
+        {
+            Bench_Result_t *p = &Bench_Results[i];
+            printf("%s,%zu,%zu,%llu,%.3f,%.3f,%.3f,%.3f,%.0f,", p->pPattern, p->dataSize, p->capacity,
+                   (unsigned long long)p->ops, p->nsMin, p->nsMedian, p->nsMean, p->nsStddev, p->bytesPerSec);
+            if (!isnan(p->nsBaseline))
+            {
+                printf("%.2f", Bench_Delta(p));
+            }
+            printf("\n");
+        }
+        break;
+
+    case Bench_Format_Json:
+        printf("[\n");
+        for (size_t i = 0; i < Bench_NumResults; i++)
+        {
+            Bench_Result_t *p = &Bench_Results[i];
+            printf("  {\"pattern\": \"%s\", \"data_size\": %zu, \"capacity\": %zu, \"ops\": %llu, "
+                   "\"ns_min\": %.3f, \"ns_median\": %.3f, \"ns_mean\": %.3f, \"ns_stddev\": %.3f, "
+                   "\"bytes_per_s\": %.0f",
+                   p->pPattern, p->dataSize, p->capacity, (unsigned long long)p->ops,
+                   p->nsMin, p->nsMedian, p->nsMean, p->nsStddev, p->bytesPerSec);
+            if (!isnan(p->nsBaseline))
+            {
+                printf(", \"ns_baseline\": %.3f, \"delta_pct\": %.2f", p->nsBaseline, Bench_Delta(p));
+            }
+            printf("}%s\n", (i + 1 < Bench_NumResults) ? "," : "");
+        }
+        printf("]\n");
+        break;
+
+    case Bench_Format_Table:
+    default:
+        printf("%-10s %9s %9s %10s %10s %9s %12s %9s\n", "pattern", "dataSize", "capacity",
+               "ns/op min", "ns/op med", "stddev", "MB/s", "delta %");
+        for (size_t i = 0; i < Bench_NumResults; i++)
+        {
+            Bench_Result_t *p = &Bench_Results[i];
+            printf("%-10s %9zu %9zu %10.2f %10.2f %9.2f %12.1f", p->pPattern, p->dataSize, p->capacity,
+                   p->nsMin, p->nsMedian, p->nsStddev, p->bytesPerSec / 1e6);
+            if (!isnan(p->nsBaseline))
+            {
+                printf(" %+9.2f", Bench_Delta(p));
+            }
+            printf("\n");
+        }
+        break;
+    }
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+int main(int argc, char **argv)
+{
+    static const size_t dataSizes[] = { 1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 4096 };
+    static const size_t capacities[] = { 16, 1024, 65536 };
+    static const size_t quickDataSizes[] = { 1, 8, 64, 4096 };
+    static const size_t quickCapacities[] = { 1024 };
+    Bench_Format_e format = Bench_Format_Table;
+    uint32_t repeats = 5;
+    bool quick = false;
+    const char *pBaseline = NULL;
+    double threshold = NAN; /* Report-only unless given */
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--format=csv") == 0)
+        {
+            format = Bench_Format_Csv;
+        }
+        else if (strcmp(argv[i], "--format=json") == 0)
+        {
+            format = Bench_Format_Json;
+        }
+        else if (strcmp(argv[i], "--format=table") == 0)
+        {
+            format = Bench_Format_Table;
+        }
+        else if (strncmp(argv[i], "--repeats=", 10) == 0)
+        {
+            repeats = (uint32_t)strtoul(&argv[i][10], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--quick") == 0)
+        {
+            quick = true;
+        }
+        else if (strncmp(argv[i], "--baseline=", 11) == 0)
+        {
+            pBaseline = &argv[i][11];
+        }
+        else if (strncmp(argv[i], "--threshold=", 12) == 0)
+        {
+            threshold = strtod(&argv[i][12], NULL);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--format=table|csv|json] [--repeats=N] [--quick] "
+                            "[--baseline=FILE] [--threshold=PCT]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (repeats == 0 || repeats > BENCH_MAX_REPEATS)
+    {
+        fprintf(stderr, "bench: --repeats must be 1 to %u\n", BENCH_MAX_REPEATS);
+        return 2;
+    }
+
+    const size_t *pDataSizes = quick ? quickDataSizes : dataSizes;
+    size_t numDataSizes = quick ? ELEMENTS_IN(quickDataSizes) : ELEMENTS_IN(dataSizes);
+    const size_t *pCapacities = quick ? quickCapacities : capacities;
+    size_t numCapacities = quick ? ELEMENTS_IN(quickCapacities) : ELEMENTS_IN(capacities);
+
+    for (size_t p = 0; p < ELEMENTS_IN(Bench_Patterns); p++)
+    {
+        for (size_t d = 0; d < numDataSizes; d++)
+        {
+            for (size_t c = 0; c < numCapacities; c++)
+            {
+                if (pDataSizes[d] * pCapacities[c] > BENCH_MAX_BUF_SIZE)
+                {
+                    continue;
+                }
+                Bench_Run(&Bench_Patterns[p], pDataSizes[d], pCapacities[c], repeats,
+                          &Bench_Results[Bench_NumResults++]);
+            }
+        }
+    }
+
+    if (pBaseline != NULL && Bench_LoadBaseline(pBaseline) != 0)
+    {
+        return 2;
+    }
+    Bench_Print(format);
+
+    /* Fail the run on a regression so it can gate a CI job. Timings on a
+     * shared machine are too noisy to gate on by default. */
+    if (isnan(threshold))
+    {
+        return 0;
+    }
+    int regressions = 0;
+    for (size_t i = 0; i < Bench_NumResults; i++)
+    {
+        if (!isnan(Bench_Results[i].nsBaseline) && Bench_Delta(&Bench_Results[i]) > threshold)
+        {
+            regressions++;
+        }
+    }
+    if (regressions > 0)
+    {
+        fprintf(stderr, "bench: %d combination(s) slower than baseline by more than %.1f%%\n",
+                regressions, threshold);
+        return 1;
+    }
+
+    return 0;
+}
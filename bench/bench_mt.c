@@ -0,0 +1,589 @@
+/*******************************************************************************
+ * @file  bench_mt.c
+ *
+ * @brief Multi-threaded throughput and latency benchmarks
+ *
+ * @details  Runs every thread-safe queue variant, plus a mutex-wrapped
+ *           Queue_t as the baseline, through the same producer/consumer
+ *           scenario. Producers stamp each element with the time stamp
+ *           counter before its first push attempt, so time spent waiting
+ *           for a full queue counts. Consumers record end-to-end latency
+ *           into a log-linear (HDR-style) histogram, and the run reports
+ *           sustained throughput and p50/p99/p99.9/max latency.
+ *
+ *           Usage: bench_mt.exe [--producers=N] [--consumers=N] [--elements=N]
+ *                               [--capacity=N] [--variant=NAME] [--pin]
+ *                               [--format=table|csv]
+ *
+ *           Variants that limit their thread counts (spsc, mpsc) are skipped
+ *           when the scenario asks for more.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "queue.h"
+#include "queue_spsc.h"
+#include "queue_mpmc.h"
+#include "queue_mpsc.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+#define BENCH_MAX_THREADS     64u
+
+/* Histogram: 2^BENCH_HIST_SUB_BITS linear buckets per power of two, so any
+ * recorded value is within about 3% of its bucket's lower bound */
+#define BENCH_HIST_SUB_BITS   5u
+#define BENCH_HIST_SUB_COUNT  (1u << BENCH_HIST_SUB_BITS)
+#define BENCH_HIST_BUCKETS    ((64u - BENCH_HIST_SUB_BITS + 1u) * BENCH_HIST_SUB_COUNT)
+
+/* Consumers publish their counts at least this often */
+#define BENCH_FLUSH_EVERY     1024u
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/* Element moved through every queue */
+typedef struct _Bench_Elem_t
+{
+    uint64_t stamp;    /* Time stamp counter at push */
+    uint32_t producer;
+    uint32_t seq;
+} Bench_Elem_t;
+
+typedef struct _Bench_Hist_t
+{
+    uint64_t counts[BENCH_HIST_BUCKETS];
+    uint64_t total;
+    uint64_t max;
+} Bench_Hist_t;
+
+/* Queue under test. The function pointers hide which variant it is. */
+typedef struct _Bench_Variant_t
+{
+    const char *pName;
+    uint32_t    maxProducers;
+    uint32_t    maxConsumers;
+    void      *(*pfnCreate)(size_t capacity);
+    void       (*pfnDestroy)(void *pQ);
+    bool       (*pfnPush)(void *pQ, Bench_Elem_t *pElem);
+    bool       (*pfnPop)(void *pQ, Bench_Elem_t *pElem);
+} Bench_Variant_t;
+
+typedef struct _Bench_Scenario_t
+{
+    uint32_t producers;
+    uint32_t consumers;
+    uint64_t elements;  /* Per producer */
+    size_t   capacity;
+    bool     pin;
+} Bench_Scenario_t;
+
+/* Shared by every thread of one run */
+typedef struct _Bench_Run_t
+{
+    const Bench_Variant_t  *pVariant;
+    const Bench_Scenario_t *pScenario;
+    void                   *pQ;
+    pthread_barrier_t       start;
+    atomic_uint_fast64_t    consumed;
+    uint64_t                total;
+} Bench_Run_t;
+
+typedef struct _Bench_Thread_t
+{
+    Bench_Run_t *pRun;
+    uint32_t     id;
+    uint32_t     cpu;
+    Bench_Hist_t hist;
+    uint64_t     errors;   /* Out of order elements seen by a consumer */
+} Bench_Thread_t;
+
+/*============================================================================*
+ *                     P R I V A T E    V A R I A B L E S                     *
+ *============================================================================*/
+
+static double Bench_NsPerTick = 1.0;
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+static uint64_t Bench_NowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/* Cheap timestamp, in ticks of Bench_NsPerTick */
+static inline uint64_t Bench_Ticks(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return Bench_NowNs();
+#endif
+}
+
+/* Measure the time stamp counter against CLOCK_MONOTONIC */
+static void Bench_Calibrate(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    struct timespec pause = { .tv_sec = 0, .tv_nsec = 50000000 };
+    uint64_t ns0 = Bench_NowNs();
+    uint64_t ticks0 = Bench_Ticks();
+    nanosleep(&pause, NULL);
+    uint64_t ns1 = Bench_NowNs();
+    uint64_t ticks1 = Bench_Ticks();
+    Bench_NsPerTick = (double)(ns1 - ns0) / (double)(ticks1 - ticks0);
+#endif
+}
+
+static void Bench_HistRecord(Bench_Hist_t *pHist, uint64_t value)
+{
+    size_t bucket;
+    if (value < BENCH_HIST_SUB_COUNT)
+    {
+        bucket = (size_t)value;
+    }
+    else
+    {
+        /* Exponent from the top set bit, then the next SUB_BITS bits */
+        uint32_t msb = 63u - (uint32_t)__builtin_clzll(value);
+        uint32_t shift = msb - BENCH_HIST_SUB_BITS;
+        bucket = (size_t)(shift + 1u) * BENCH_HIST_SUB_COUNT +
+                 (size_t)((value >> shift) & (BENCH_HIST_SUB_COUNT - 1u));
+    }
+    pHist->counts[bucket]++;
+    pHist->total++;
+    if (value > pHist->max)
+    {
+        pHist->max = value;
+    }
+}
+
+/* Lowest value that lands in a bucket */
+static uint64_t Bench_HistBucketValue(size_t bucket)
+{
+    if (bucket < BENCH_HIST_SUB_COUNT)
+    {
+        return bucket;
+    }
+    uint32_t shift = (uint32_t)(bucket / BENCH_HIST_SUB_COUNT) - 1u;
+    uint64_t sub = bucket % BENCH_HIST_SUB_COUNT;
+    return (BENCH_HIST_SUB_COUNT + sub) << shift;
+}
+
+static void Bench_HistMerge(Bench_Hist_t *pDst, const Bench_Hist_t *pSrc)
+{
+    for (size_t i = 0; i < BENCH_HIST_BUCKETS; i++)
+    {
+        pDst->counts[i] += pSrc->counts[i];
+    }
+    pDst->total += pSrc->total;
+    if (pSrc->max > pDst->max)
+    {
+        pDst->max = pSrc->max;
+    }
+}
+
+static uint64_t Bench_HistPercentile(const Bench_Hist_t *pHist, double percentile)
+{
+    uint64_t rank = (uint64_t)(percentile / 100.0 * (double)pHist->total);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BENCH_HIST_BUCKETS; i++)
+    {
+        seen += pHist->counts[i];
+        if (seen > rank)
+        {
+            return Bench_HistBucketValue(i);
+        }
+    }
+    return pHist->max;
+}
+
+/*----------------------------------------------------------------------------*
+ * Variants                                                                   *
+ *----------------------------------------------------------------------------*/
+
+typedef struct _Bench_Mutex_t
+{
+    pthread_mutex_t lock;
+    Queue_t         queue;
+} Bench_Mutex_t;
+
+static void *Bench_MutexCreate(size_t capacity)
+{
+    Bench_Mutex_t *pQ = malloc(sizeof(*pQ));
+    pthread_mutex_init(&pQ->lock, NULL);
+    Queue_Init(&pQ->queue, malloc(capacity * sizeof(Bench_Elem_t)), capacity * sizeof(Bench_Elem_t),
+               sizeof(Bench_Elem_t));
+    return pQ;
+}
+
+static void Bench_MutexDestroy(void *pQ)
+{
+    Bench_Mutex_t *pMutex = pQ;
+    pthread_mutex_destroy(&pMutex->lock);
+    free(pMutex->queue.pBuf);
+    free(pMutex);
+}
+
+static bool Bench_MutexPush(void *pQ, Bench_Elem_t *pElem)
+{
+    Bench_Mutex_t *pMutex = pQ;
+    pthread_mutex_lock(&pMutex->lock);
+    Queue_Error_e err = Queue_Push(&pMutex->queue, pElem);
+    pthread_mutex_unlock(&pMutex->lock);
+    return err == Queue_Error_None;
+}
+
+static bool Bench_MutexPop(void *pQ, Bench_Elem_t *pElem)
+{
+    Bench_Mutex_t *pMutex = pQ;
+    pthread_mutex_lock(&pMutex->lock);
+    Queue_Error_e err = Queue_Pop(&pMutex->queue, pElem);
+    pthread_mutex_unlock(&pMutex->lock);
+    return err == Queue_Error_None;
+}
+
+/* Lock-free variants allocate the object and its buffer in one cache line
+ * aligned block */
+static void *Bench_AlignedAlloc(size_t size)
+{
+    size = (size + QUEUE_CACHE_LINE_SIZE - 1) & ~(size_t)(QUEUE_CACHE_LINE_SIZE - 1);
+    return aligned_alloc(QUEUE_CACHE_LINE_SIZE, size);
+}
+
+static void *Bench_SpscCreate(size_t capacity)
+{
+    size_t bufSize = capacity * sizeof(Bench_Elem_t);
+    QueueSpsc_t *pQ = Bench_AlignedAlloc(sizeof(QueueSpsc_t) + bufSize);
+    QueueSpsc_Init(pQ, &pQ[1], bufSize, sizeof(Bench_Elem_t));
+    return pQ;
+}
+
+static bool Bench_SpscPush(void *pQ, Bench_Elem_t *pElem)
+{
+    return QueueSpsc_Push(pQ, pElem) == Queue_Error_None;
+}
+
+static bool Bench_SpscPop(void *pQ, Bench_Elem_t *pElem)
+{
+    return QueueSpsc_Pop(pQ, pElem) == Queue_Error_None;
+}
+
+static void *Bench_MpmcCreate(size_t capacity)
+{
+    size_t bufSize = QUEUE_MPMC_BUF_SIZE(capacity, sizeof(Bench_Elem_t));
+    QueueMpmc_t *pQ = Bench_AlignedAlloc(sizeof(QueueMpmc_t) + bufSize);
+    QueueMpmc_Init(pQ, &pQ[1], bufSize, sizeof(Bench_Elem_t));
+    return pQ;
+}
+
+static bool Bench_MpmcPush(void *pQ, Bench_Elem_t *pElem)
+{
+    return QueueMpmc_Push(pQ, pElem) == Queue_Error_None;
+}
+
+static bool Bench_MpmcPop(void *pQ, Bench_Elem_t *pElem)
+{
+    return QueueMpmc_Pop(pQ, pElem) == Queue_Error_None;
+}
+
+static void *Bench_MpscCreate(size_t capacity)
+{
+    size_t bufSize = QUEUE_MPSC_BUF_SIZE(capacity, sizeof(Bench_Elem_t));
+    QueueMpsc_t *pQ = Bench_AlignedAlloc(sizeof(QueueMpsc_t) + bufSize);
+    QueueMpsc_Init(pQ, &pQ[1], bufSize, sizeof(Bench_Elem_t));
+    return pQ;
+}
+
+static bool Bench_MpscPush(void *pQ, Bench_Elem_t *pElem)
+{
+    return QueueMpsc_Push(pQ, pElem) == Queue_Error_None;
+}
+
+static bool Bench_MpscPop(void *pQ, Bench_Elem_t *pElem)
+{
+    return QueueMpsc_Pop(pQ, pElem) == Queue_Error_None;
+}
+
+static const Bench_Variant_t Bench_Variants[] = {
+    { "mutex", BENCH_MAX_THREADS, BENCH_MAX_THREADS,
+      Bench_MutexCreate, Bench_MutexDestroy, Bench_MutexPush, Bench_MutexPop },
+    { "spsc", 1, 1, Bench_SpscCreate, free, Bench_SpscPush, Bench_SpscPop },
+    { "mpmc", BENCH_MAX_THREADS, BENCH_MAX_THREADS,
+      Bench_MpmcCreate, free, Bench_MpmcPush, Bench_MpmcPop },
+    { "mpsc", BENCH_MAX_THREADS, 1, Bench_MpscCreate, free, Bench_MpscPush, Bench_MpscPop },
+};
+
+/*----------------------------------------------------------------------------*
+ * Threads                                                                    *
+ *----------------------------------------------------------------------------*/
+
+static void Bench_Pin(uint32_t cpu)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+static void *Bench_Producer(void *pArg)
+{
+    Bench_Thread_t *pThread = pArg;
+    Bench_Run_t *pRun = pThread->pRun;
+    const Bench_Variant_t *pVariant = pRun->pVariant;
+
+    if (pRun->pScenario->pin)
+    {
+        Bench_Pin(pThread->cpu);
+    }
+    pthread_barrier_wait(&pRun->start);
+
+    for (uint64_t i = 0; i < pRun->pScenario->elements; i++)
+    {
+        /* Stamp once, so latency includes any wait for space in a full queue */
+        Bench_Elem_t elem = { .producer = pThread->id, .seq = (uint32_t)i };
+        elem.stamp = Bench_Ticks();
+        while (!pVariant->pfnPush(pRun->pQ, &elem))
+        {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+static void *Bench_Consumer(void *pArg)
+{
+    Bench_Thread_t *pThread = pArg;
+    Bench_Run_t *pRun = pThread->pRun;
+    const Bench_Variant_t *pVariant = pRun->pVariant;
+    uint32_t next[BENCH_MAX_THREADS] = { 0 };
+    bool checkOrder = (pRun->pScenario->consumers == 1);
+    uint64_t local = 0;
+
+    if (pRun->pScenario->pin)
+    {
+        Bench_Pin(pThread->cpu);
+    }
+    pthread_barrier_wait(&pRun->start);
+
+    for (;;)
+    {
+        Bench_Elem_t elem;
+        bool popped = pVariant->pfnPop(pRun->pQ, &elem);
+        if (popped)
+        {
+            uint64_t now = Bench_Ticks();
+            Bench_HistRecord(&pThread->hist, (uint64_t)((double)(now - elem.stamp) * Bench_NsPerTick));
+            if (checkOrder)
+            {
+                pThread->errors += (elem.seq != next[elem.producer]++);
+            }
+            if (++local < BENCH_FLUSH_EVERY)
+            {
+                continue;
+            }
+        }
+
+        /* Publish progress when idle or every so often, and stop once
+         * everything has been consumed */
+        uint64_t consumed = atomic_fetch_add_explicit(&pRun->consumed, local, memory_order_relaxed) + local;
+        local = 0;
+        if (consumed == pRun->total)
+        {
+            break;
+        }
+        if (!popped)
+        {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+/* Run one variant through the scenario and print one result line */
+static void Bench_RunVariant(const Bench_Variant_t *pVariant, const Bench_Scenario_t *pScenario,
+                             bool csv)
+{
+    static Bench_Thread_t threads[2 * BENCH_MAX_THREADS];
+    pthread_t handles[2 * BENCH_MAX_THREADS];
+    uint32_t numThreads = pScenario->producers + pScenario->consumers;
+    long numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+    Bench_Run_t run = {
+        .pVariant = pVariant,
+        .pScenario = pScenario,
+        .pQ = pVariant->pfnCreate(pScenario->capacity),
+        .total = pScenario->producers * pScenario->elements,
+    };
+
+    atomic_init(&run.consumed, 0);
+    pthread_barrier_init(&run.start, NULL, numThreads + 1);
+
+    for (uint32_t i = 0; i < numThreads; i++)
+    {
+        bool isProducer = (i < pScenario->producers);
+        memset(&threads[i], 0, sizeof(threads[i]));
+        threads[i].pRun = &run;
+        threads[i].id = isProducer ? i : i - pScenario->producers;
+        threads[i].cpu = (uint32_t)(i % (numCpus > 0 ? (uint32_t)numCpus : 1u));
+        pthread_create(&handles[i], NULL, isProducer ? Bench_Producer : Bench_Consumer, &threads[i]);
+    }
+
+    pthread_barrier_wait(&run.start);
+    uint64_t start = Bench_NowNs();
+    for (uint32_t i = 0; i < numThreads; i++)
+    {
+        pthread_join(handles[i], NULL);
+    }
+    uint64_t elapsed = Bench_NowNs() - start;
+
+    static Bench_Hist_t hist;
+    uint64_t errors = 0;
+    memset(&hist, 0, sizeof(hist));
+    for (uint32_t i = pScenario->producers; i < numThreads; i++)
+    {
+        Bench_HistMerge(&hist, &threads[i].hist);
+        errors += threads[i].errors;
+    }
+
+    double mops = (double)run.total * 1e3 / (double)elapsed;
+    const char *pFormat = csv ? "%s,%u,%u,%zu,%.3f,%llu,%llu,%llu,%llu,%llu\n"
+                              : "%-6s %4u %4u %9zu %10.3f %10llu %10llu %10llu %12llu %7llu\n";
+    printf(pFormat, pVariant->pName, pScenario->producers, pScenario->consumers, pScenario->capacity,
+           mops,
+           (unsigned long long)Bench_HistPercentile(&hist, 50.0),
+           (unsigned long long)Bench_HistPercentile(&hist, 99.0),
+           (unsigned long long)Bench_HistPercentile(&hist, 99.9),
+           (unsigned long long)hist.max,
+           (unsigned long long)errors);
+
+    pthread_barrier_destroy(&run.start);
+    pVariant->pfnDestroy(run.pQ);
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+int main(int argc, char **argv)
+{
+    Bench_Scenario_t scenario = {
+        .producers = 1,
+        .consumers = 1,
+        .elements = 1000000,
+        .capacity = 1024,
+        .pin = false,
+    };
+    const char *pVariant = NULL;
+    bool csv = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--producers=", 12) == 0)
+        {
+            scenario.producers = (uint32_t)strtoul(&argv[i][12], NULL, 10);
+        }
+        else if (strncmp(argv[i], "--consumers=", 12) == 0)
+        {
+            scenario.consumers = (uint32_t)strtoul(&argv[i][12], NULL, 10);
+        }
+        else if (strncmp(argv[i], "--elements=", 11) == 0)
+        {
+            scenario.elements = strtoull(&argv[i][11], NULL, 10);
+        }
+        else if (strncmp(argv[i], "--capacity=", 11) == 0)
+        {
+            scenario.capacity = (size_t)strtoull(&argv[i][11], NULL, 10);
+        }
+        else if (strncmp(argv[i], "--variant=", 10) == 0)
+        {
+            pVariant = &argv[i][10];
+        }
+        else if (strcmp(argv[i], "--pin") == 0)
+        {
+            scenario.pin = true;
+        }
+        else if (strcmp(argv[i], "--format=csv") == 0)
+        {
+            csv = true;
+        }
+        else if (strcmp(argv[i], "--format=table") == 0)
+        {
+            csv = false;
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--producers=N] [--consumers=N] [--elements=N] [--capacity=N] "
+                            "[--variant=NAME] [--pin] [--format=table|csv]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    /* The lock-free variants need a power-of-two capacity, so all get one */
+    size_t capacity = 2;
+    while (capacity < scenario.capacity)
+    {
+        capacity <<= 1;
+    }
+    scenario.capacity = capacity;
+
+    if (scenario.producers == 0 || scenario.consumers == 0 ||
+        scenario.producers > BENCH_MAX_THREADS || scenario.consumers > BENCH_MAX_THREADS ||
+        scenario.elements == 0 || scenario.elements > UINT32_MAX)
+    {
+        fprintf(stderr, "bench_mt: thread counts must be 1 to %u and elements 1 to %u\n",
+                BENCH_MAX_THREADS, UINT32_MAX);
+        return 2;
+    }
+
+    Bench_Calibrate();
+
+    if (csv)
+    {
+        printf("variant,producers,consumers,capacity,mops,p50_ns,p99_ns,p999_ns,max_ns,order_errors\n");
+    }
+    else
+    {
+        printf("%-6s %4s %4s %9s %10s %10s %10s %10s %12s %7s\n", "queue", "prod", "cons", "capacity",
+               "Mops/s", "p50 ns", "p99 ns", "p99.9 ns", "max ns", "errors");
+    }
+
+    for (size_t i = 0; i < sizeof(Bench_Variants) / sizeof(Bench_Variants[0]); i++)
+    {
+        const Bench_Variant_t *pV = &Bench_Variants[i];
+        if ((pVariant != NULL && strcmp(pVariant, pV->pName) != 0) ||
+            scenario.producers > pV->maxProducers || scenario.consumers > pV->maxConsumers)
+        {
+            continue;
+        }
+        Bench_RunVariant(pV, &scenario, csv);
+    }
+
+    return 0;
+}
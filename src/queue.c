@@ -9,13 +9,148 @@
 /*============================================================================*
  *                              I N C L U D E S                               *
  *============================================================================*/
+#include <string.h>
+
 #include "queue.h"
+#include "queue_copy.h"
+#include "queue_trace.h"
+
+/*============================================================================*
+ *                     P R I V A T E    V A R I A B L E S                     *
+ *============================================================================*/
+
+QUEUE_TRACE_SEMAPHORE(push);
+QUEUE_TRACE_SEMAPHORE(pop);
+QUEUE_TRACE_SEMAPHORE(peek);
+QUEUE_TRACE_SEMAPHORE(full);
+QUEUE_TRACE_SEMAPHORE(empty);
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/* Number of bytes currently held by the queue */
+static inline size_t Queue_UsedBytes(Queue_t *pObj)
+{
+    if (pObj->front == SIZE_MAX)
+    {
+        return 0;
+    }
+    return (pObj->rear > pObj->front) ? (pObj->rear - pObj->front)
+                                      : (pObj->bufSize - pObj->front + pObj->rear);
+}
+
+/* Number of free bytes that follow the rear cursor without wrapping */
+static inline size_t Queue_ContiguousFreeBytes(Queue_t *pObj)
+{
+    /* A mirrored buffer never wraps, every free byte is contiguous */
+    if (pObj->mirrored)
+    {
+        return pObj->bufSize - Queue_UsedBytes(pObj);
+    }
+    if (pObj->front == SIZE_MAX)
+    {
+        return pObj->bufSize - pObj->rear;
+    }
+    return (pObj->rear < pObj->front) ? (pObj->front - pObj->rear)
+         : (pObj->rear == pObj->front) ? 0
+         : (pObj->bufSize - pObj->rear);
+}
+
+/* Free bytes Queue_ReserveWrite() offers. An empty queue restarts at the top
+ * of the buffer to offer the longest run, which Queue_CommitWrite() applies. */
+static inline size_t Queue_ReservableBytes(Queue_t *pObj)
+{
+    return (pObj->front == SIZE_MAX) ? pObj->bufSize : Queue_ContiguousFreeBytes(pObj);
+}
+
+/* Number of used bytes that follow the front cursor without wrapping */
+static inline size_t Queue_ContiguousUsedBytes(Queue_t *pObj)
+{
+    if (pObj->mirrored)
+    {
+        return Queue_UsedBytes(pObj);
+    }
+    if (pObj->front == SIZE_MAX)
+    {
+        return 0;
+    }
+    return (pObj->rear > pObj->front) ? (pObj->rear - pObj->front)
+                                      : (pObj->bufSize - pObj->front);
+}
+
+/* Step a cursor forward by bytes around the buffer */
+static inline void Queue_Advance(Queue_t *pObj, size_t *pCursor, size_t bytes)
+{
+    *pCursor += bytes;
+    if (*pCursor >= pObj->bufSize)
+    {
+        *pCursor -= pObj->bufSize;
+    }
+}
+
+/* Statistics hooks. Only the owning thread writes, so a relaxed load and
+ * store is enough and avoids a locked read-modify-write. */
+#ifdef QUEUE_STATS
+static inline void Queue_StatsAdd(atomic_uint_least64_t *pCounter, uint64_t n)
+{
+    atomic_store_explicit(pCounter, atomic_load_explicit(pCounter, memory_order_relaxed) + n,
+                          memory_order_relaxed);
+}
+
+static void Queue_StatsPushed(Queue_t *pObj, size_t numElems)
+{
+    uint64_t count = Queue_UsedBytes(pObj) / pObj->dataSize;
+
+    Queue_StatsAdd(&pObj->stats.pushes, numElems);
+    if (count > atomic_load_explicit(&pObj->stats.highWater, memory_order_relaxed))
+    {
+        atomic_store_explicit(&pObj->stats.highWater, count, memory_order_relaxed);
+    }
+    if (count > 0)
+    {
+        Queue_StatsAdd(&pObj->stats.occupancy[63 - __builtin_clzll(count)], 1);
+    }
+}
+
+#define Queue_StatsPopped(pObj, numElems)  Queue_StatsAdd(&(pObj)->stats.pops, (numElems))
+#define Queue_StatsFull(pObj)              Queue_StatsAdd(&(pObj)->stats.fullRejects, 1)
+#define Queue_StatsEmpty(pObj)             Queue_StatsAdd(&(pObj)->stats.emptyRejects, 1)
+#else
+#define Queue_StatsPushed(pObj, numElems)  ((void)0)
+#define Queue_StatsPopped(pObj, numElems)  ((void)0)
+#define Queue_StatsFull(pObj)              ((void)0)
+#define Queue_StatsEmpty(pObj)             ((void)0)
+#endif
+
+/* Transition hooks. A queue without any attached pays a single predictable
+ * branch. */
+static inline void Queue_HookPushed(Queue_t *pObj, size_t numElems)
+{
+    if (__builtin_expect(pObj->pHooks != NULL, 0))
+    {
+        pObj->pHooks->pfnPushed(pObj, numElems);
+    }
+}
+
+static inline void Queue_HookPopped(Queue_t *pObj, size_t numElems)
+{
+    if (__builtin_expect(pObj->pHooks != NULL, 0))
+    {
+        pObj->pHooks->pfnPopped(pObj, numElems);
+    }
+}
 
 /*============================================================================*
  *                      P U B L I C    F U N C T I O N S                      *
  *============================================================================*/
 
 Queue_Error_e Queue_Init(Queue_t *pObj, void *pBuf, size_t bufSize, size_t dataSize)
+{
+    return Queue_InitEx(pObj, pBuf, bufSize, dataSize, Queue_Flag_None);
+}
+
+Queue_Error_e Queue_InitEx(Queue_t *pObj, void *pBuf, size_t bufSize, size_t dataSize, uint32_t flags)
 {
     if (bufSize % dataSize != 0 || bufSize == SIZE_MAX) {
         return Queue_Error;
@@ -25,6 +160,15 @@ Queue_Error_e Queue_Init(Queue_t *pObj, void *pBuf, size_t bufSize, size_t dataS
     pObj->rear = 0;
     pObj->pBuf = pBuf;
     pObj->dataSize = dataSize;
+    pObj->pfnCopy = Queue_Copy_Select(dataSize);
+    pObj->mirrored = false;
+    pObj->flags = flags;
+    pObj->overwritten = 0;
+    pObj->pHooks = NULL;
+    pObj->fdOffset = 0;
+#ifdef QUEUE_STATS
+    memset(&pObj->stats, 0, sizeof(pObj->stats));
+#endif
 
     return Queue_Error_None;
 }
@@ -39,11 +183,31 @@ bool Queue_IsFull(Queue_t *pObj)
     return (pObj->rear == pObj->front);
 }
 
+size_t Queue_Count(Queue_t *pObj)
+{
+    return Queue_UsedBytes(pObj) / pObj->dataSize;
+}
+
+uint64_t Queue_Overwritten(Queue_t *pObj)
+{
+    return pObj->overwritten;
+}
+
 Queue_Error_e Queue_Push(Queue_t *pObj, void *pDataInVoid)
 {
     if (Queue_IsFull(pObj))
     {
-        return Queue_Error;
+        if ((pObj->flags & Queue_Flag_Overwrite) == 0)
+        {
+            Queue_StatsFull(pObj);
+            QUEUE_TRACE(full, pObj, Queue_Count(pObj));
+            return Queue_Error;
+        }
+
+        /* Drop the oldest element, its slot is the one about to be written */
+        Queue_Advance(pObj, &pObj->front, pObj->dataSize);
+        pObj->overwritten++;
+        pObj->fdOffset = 0;
     }
 
     /* If empty, unstash front cursor */
@@ -53,16 +217,17 @@ Queue_Error_e Queue_Push(Queue_t *pObj, void *pDataInVoid)
     }
 
     /* Push the data into the queue */
-    for (size_t byte = 0; byte < pObj->dataSize; byte++)
-    {
-        pObj->pBuf[pObj->rear++] = ((uint8_t *)pDataInVoid)[byte];
-    }
+    pObj->pfnCopy(&pObj->pBuf[pObj->rear], pDataInVoid, pObj->dataSize);
+    pObj->rear += pObj->dataSize;
 
     /* Increment cursor around buffer */
     if (pObj->rear == pObj->bufSize)
     {
         pObj->rear = 0;
     }
+    Queue_StatsPushed(pObj, 1);
+    Queue_HookPushed(pObj, 1);
+    QUEUE_TRACE(push, pObj, Queue_Count(pObj));
 
     return Queue_Error_None;
 }
@@ -71,14 +236,15 @@ Queue_Error_e Queue_Pop(Queue_t *pObj, void *pDataOutVoid)
 {
     if (Queue_IsEmpty(pObj))
     {
+        Queue_StatsEmpty(pObj);
+        QUEUE_TRACE(empty, pObj, 0);
         return Queue_Error;
     }
 
     /* Pop the data off the queue */
-    for (size_t byte = 0; byte < pObj->dataSize; byte++)
-    {
-        ((uint8_t *)pDataOutVoid)[byte] = pObj->pBuf[pObj->front++];
-    }
+    pObj->pfnCopy(pDataOutVoid, &pObj->pBuf[pObj->front], pObj->dataSize);
+    pObj->front += pObj->dataSize;
+    pObj->fdOffset = 0;
 
     /* Increment cursor around buffer */
     if (pObj->front == pObj->bufSize)
@@ -91,6 +257,9 @@ Queue_Error_e Queue_Pop(Queue_t *pObj, void *pDataOutVoid)
     {
         pObj->front = SIZE_MAX;
     }
+    Queue_StatsPopped(pObj, 1);
+    Queue_HookPopped(pObj, 1);
+    QUEUE_TRACE(pop, pObj, Queue_Count(pObj));
 
     return Queue_Error_None;
 }
@@ -99,15 +268,273 @@ Queue_Error_e Queue_Peek(Queue_t *pObj, void *pDataOutVoid)
 {
     if (Queue_IsEmpty(pObj))
     {
+        QUEUE_TRACE(empty, pObj, 0);
         return Queue_Error;
     }
 
     /* Copy the data out without updating object state */
-    size_t front = pObj->front;
-    for (size_t byte = 0; byte < pObj->dataSize; byte++)
+    pObj->pfnCopy(pDataOutVoid, &pObj->pBuf[pObj->front], pObj->dataSize);
+    QUEUE_TRACE(peek, pObj, Queue_Count(pObj));
+
+    return Queue_Error_None;
+}
+
+size_t Queue_PushN(Queue_t *pObj, void *pDataInVoid, size_t numElems)
+{
+    size_t freeElems = (pObj->bufSize - Queue_UsedBytes(pObj)) / pObj->dataSize;
+    size_t skipped = 0;
+
+    if (numElems > freeElems && (pObj->flags & Queue_Flag_Overwrite) != 0)
+    {
+        /* Only the newest capacity elements of the array can survive */
+        size_t capacity = pObj->bufSize / pObj->dataSize;
+        if (numElems > capacity)
+        {
+            skipped = numElems - capacity;
+            pDataInVoid = (uint8_t *)pDataInVoid + skipped * pObj->dataSize;
+            pObj->overwritten += skipped;
+            numElems = capacity;
+        }
+
+        /* Drop the oldest elements to make room. This may leave front == rear
+         * for a moment, which the copy below immediately makes full. */
+        if (numElems > freeElems)
+        {
+            Queue_Advance(pObj, &pObj->front, (numElems - freeElems) * pObj->dataSize);
+            pObj->overwritten += numElems - freeElems;
+            pObj->fdOffset = 0;
+            freeElems = numElems;
+        }
+    }
+    size_t bytes = ((numElems < freeElems) ? numElems : freeElems) * pObj->dataSize;
+
+    if (bytes == 0)
+    {
+        return 0;
+    }
+
+    /* If empty, unstash front cursor */
+    if (pObj->front == SIZE_MAX)
+    {
+        pObj->front = pObj->rear;
+    }
+
+    /* One copy through the mirror, otherwise up to the end then from the start */
+    if (pObj->mirrored)
+    {
+        memcpy(&pObj->pBuf[pObj->rear], pDataInVoid, bytes);
+    }
+    else
+    {
+        size_t first = pObj->bufSize - pObj->rear;
+        if (first > bytes)
+        {
+            first = bytes;
+        }
+        memcpy(&pObj->pBuf[pObj->rear], pDataInVoid, first);
+        memcpy(pObj->pBuf, (uint8_t *)pDataInVoid + first, bytes - first);
+    }
+
+    /* Increment cursor around buffer */
+    pObj->rear += bytes;
+    if (pObj->rear >= pObj->bufSize)
+    {
+        pObj->rear -= pObj->bufSize;
+    }
+
+    Queue_StatsPushed(pObj, bytes / pObj->dataSize);
+    Queue_HookPushed(pObj, bytes / pObj->dataSize);
+
+    return skipped + bytes / pObj->dataSize;
+}
+
+size_t Queue_PopN(Queue_t *pObj, void *pDataOutVoid, size_t numElems)
+{
+    size_t usedElems = Queue_UsedBytes(pObj) / pObj->dataSize;
+    size_t bytes = ((numElems < usedElems) ? numElems : usedElems) * pObj->dataSize;
+
+    if (bytes == 0)
+    {
+        return 0;
+    }
+
+    /* One copy through the mirror, otherwise up to the end then from the start */
+    if (pObj->mirrored)
+    {
+        memcpy(pDataOutVoid, &pObj->pBuf[pObj->front], bytes);
+    }
+    else
+    {
+        size_t first = pObj->bufSize - pObj->front;
+        if (first > bytes)
+        {
+            first = bytes;
+        }
+        memcpy(pDataOutVoid, &pObj->pBuf[pObj->front], first);
+        memcpy((uint8_t *)pDataOutVoid + first, pObj->pBuf, bytes - first);
+    }
+
+    /* Increment cursor around buffer */
+    pObj->front += bytes;
+    pObj->fdOffset = 0;
+    if (pObj->front >= pObj->bufSize)
+    {
+        pObj->front -= pObj->bufSize;
+    }
+
+    /* If empty, stash front cursor */
+    if (pObj->front == pObj->rear)
+    {
+        pObj->front = SIZE_MAX;
+    }
+    Queue_StatsPopped(pObj, bytes / pObj->dataSize);
+    Queue_HookPopped(pObj, bytes / pObj->dataSize);
+
+    return bytes / pObj->dataSize;
+}
+
+void *Queue_ReserveWrite(Queue_t *pObj, size_t *pNumElems)
+{
+    size_t numElems = Queue_ReservableBytes(pObj) / pObj->dataSize;
+    size_t rear = (pObj->front == SIZE_MAX) ? 0 : pObj->rear;
+    if (pNumElems != NULL)
+    {
+        *pNumElems = numElems;
+    }
+
+    return (numElems > 0) ? &pObj->pBuf[rear] : NULL;
+}
+
+Queue_Error_e Queue_CommitWrite(Queue_t *pObj, size_t numElems)
+{
+    size_t bytes = numElems * pObj->dataSize;
+
+    if (numElems > Queue_ReservableBytes(pObj) / pObj->dataSize)
+    {
+        return Queue_Error;
+    }
+    if (bytes == 0)
+    {
+        return Queue_Error_None;
+    }
+
+    /* If empty, rewind to the top where the slots were reserved and unstash
+     * front cursor */
+    if (pObj->front == SIZE_MAX)
+    {
+        pObj->rear = 0;
+        pObj->front = 0;
+    }
+
+    /* Increment cursor around buffer, a mirrored run may cross the end */
+    pObj->rear += bytes;
+    if (pObj->rear >= pObj->bufSize)
     {
-        ((uint8_t *)pDataOutVoid)[byte] = pObj->pBuf[front++];
+        pObj->rear -= pObj->bufSize;
     }
+    Queue_StatsPushed(pObj, numElems);
+    Queue_HookPushed(pObj, numElems);
 
     return Queue_Error_None;
-}
\ No newline at end of file
+}
+
+void *Queue_PeekRef(Queue_t *pObj, size_t *pNumElems)
+{
+    size_t numElems = Queue_ContiguousUsedBytes(pObj) / pObj->dataSize;
+    if (pNumElems != NULL)
+    {
+        *pNumElems = numElems;
+    }
+
+    return (numElems > 0) ? &pObj->pBuf[pObj->front] : NULL;
+}
+
+Queue_Error_e Queue_Release(Queue_t *pObj, size_t numElems)
+{
+    size_t bytes = numElems * pObj->dataSize;
+
+    if (numElems > Queue_UsedBytes(pObj) / pObj->dataSize)
+    {
+        return Queue_Error;
+    }
+    if (bytes == 0)
+    {
+        return Queue_Error_None;
+    }
+
+    /* Increment cursor around buffer */
+    pObj->front += bytes;
+    pObj->fdOffset = 0;
+    if (pObj->front >= pObj->bufSize)
+    {
+        pObj->front -= pObj->bufSize;
+    }
+
+    /* If empty, stash front cursor */
+    if (pObj->front == pObj->rear)
+    {
+        pObj->front = SIZE_MAX;
+    }
+    Queue_StatsPopped(pObj, numElems);
+    Queue_HookPopped(pObj, numElems);
+
+    return Queue_Error_None;
+}
+
+size_t Queue_Drain(Queue_t *pObj, Queue_Drain_f pfnVisit, void *pCtx, size_t maxElems)
+{
+    size_t numElems = Queue_UsedBytes(pObj) / pObj->dataSize;
+    if (maxElems > numElems)
+    {
+        maxElems = numElems;
+    }
+    if (maxElems == 0)
+    {
+        return 0;
+    }
+
+    /* Visit the run up to the end of the buffer, then the run from its start */
+    uint8_t *pElem = &pObj->pBuf[pObj->front];
+    size_t runElems = Queue_ContiguousUsedBytes(pObj) / pObj->dataSize;
+    size_t visited = 0;
+    bool more = true;
+    while (more && visited < maxElems)
+    {
+        if (runElems == 0)
+        {
+            pElem = pObj->pBuf;
+            runElems = maxElems - visited;
+        }
+        more = pfnVisit(pCtx, pElem);
+        pElem += pObj->dataSize;
+        runElems--;
+        visited++;
+    }
+
+    /* Hand every visited slot back at once */
+    Queue_Release(pObj, visited);
+
+    return visited;
+}
+
+Queue_Error_e Queue_GetStats(Queue_t *pObj, Queue_Stats_t *pStats)
+{
+#ifdef QUEUE_STATS
+    pStats->pushes = atomic_load_explicit(&pObj->stats.pushes, memory_order_relaxed);
+    pStats->pops = atomic_load_explicit(&pObj->stats.pops, memory_order_relaxed);
+    pStats->fullRejects = atomic_load_explicit(&pObj->stats.fullRejects, memory_order_relaxed);
+    pStats->emptyRejects = atomic_load_explicit(&pObj->stats.emptyRejects, memory_order_relaxed);
+    pStats->highWater = atomic_load_explicit(&pObj->stats.highWater, memory_order_relaxed);
+    for (size_t i = 0; i < QUEUE_STATS_BUCKETS; i++)
+    {
+        pStats->occupancy[i] = atomic_load_explicit(&pObj->stats.occupancy[i], memory_order_relaxed);
+    }
+
+    return Queue_Error_None;
+#else
+    (void)pObj;
+    (void)pStats;
+
+    return Queue_Error;
+#endif
+}
@@ -36,6 +36,24 @@
  ******************************************************************************/
 Queue_Error_e Queue_Init(Queue_t *pObj, void *pBuf, size_t bufSize, size_t dataSize);
 
+/*******************************************************************************
+ * @brief  Initializes the queue object with behaviour flags
+ *
+ * @details  Same as Queue_Init() with flags. With Queue_Flag_Overwrite, a
+ *           push onto a full queue drops the oldest element instead of failing
+ *           and counts it in Queue_Overwritten(). Queue_ReserveWrite() still
+ *           only offers free slots.
+ *
+ * @param pObj      Pointer to the queue object
+ * @param pBuf      Pointer to the queue buffer
+ * @param bufSize   Queue buffer size. Must be an integer multiple of datasize
+ * @param dataSize  Size of the data type that the queue is handling
+ * @param flags     Bitwise OR of Queue_Flag_e values
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e Queue_InitEx(Queue_t *pObj, void *pBuf, size_t bufSize, size_t dataSize, uint32_t flags);
+
 /*******************************************************************************
  * @brief  Check if the queue is empty
  *
@@ -54,13 +72,31 @@ bool Queue_IsEmpty(Queue_t *pObj);
  ******************************************************************************/
 bool Queue_IsFull(Queue_t *pObj);
 
+/*******************************************************************************
+ * @brief  Number of elements in the queue
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns Element count
+ ******************************************************************************/
+size_t Queue_Count(Queue_t *pObj);
+
+/*******************************************************************************
+ * @brief  Number of elements dropped to make room under Queue_Flag_Overwrite
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns Overwritten element count since init
+ ******************************************************************************/
+uint64_t Queue_Overwritten(Queue_t *pObj);
+
 /*******************************************************************************
  * @brief  Pushes some data type onto the queue
  *
  * @param pObj         Pointer to the queue object
  * @param pDataInVoid  Pointer to the data that will be pushed onto the queue
  *
- * @returns Queue error flag
+ * @returns Queue error flag. Never Queue_Error under Queue_Flag_Overwrite.
  ******************************************************************************/
 Queue_Error_e Queue_Push(Queue_t *pObj, void *pDataInVoid);
 
@@ -84,4 +120,123 @@ Queue_Error_e Queue_Pop(Queue_t *pObj, void *pDataOutVoid);
  ******************************************************************************/
 Queue_Error_e Queue_Peek(Queue_t *pObj, void *pDataOutVoid);
 
+/*******************************************************************************
+ * @brief  Pushes up to numElems data types onto the queue
+ *
+ * @details  Copies at most two contiguous segments, one up to the end of the
+ *           buffer and one from its start, instead of going element by element.
+ *
+ * @param pObj         Pointer to the queue object
+ * @param pDataInVoid  Pointer to an array of data that will be pushed
+ * @param numElems     Number of elements in the array
+ *
+ * @returns Number of elements pushed. Less than numElems if the queue filled
+ *          up, unless under Queue_Flag_Overwrite, where the oldest elements
+ *          make way and only the newest capacity elements of the array are
+ *          kept.
+ ******************************************************************************/
+size_t Queue_PushN(Queue_t *pObj, void *pDataInVoid, size_t numElems);
+
+/*******************************************************************************
+ * @brief  Pops up to numElems data types off the queue
+ *
+ * @details  Copies at most two contiguous segments, one up to the end of the
+ *           buffer and one from its start, instead of going element by element.
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to an array that receives the popped data
+ * @param numElems      Capacity of the array in elements
+ *
+ * @returns Number of elements popped. Less than numElems if the queue emptied.
+ ******************************************************************************/
+size_t Queue_PopN(Queue_t *pObj, void *pDataOutVoid, size_t numElems);
+
+/*******************************************************************************
+ * @brief  Reserve free slots at the rear of the queue for in-place writing
+ *
+ * @details  The caller builds elements directly in the returned slots and
+ *           then makes them visible with Queue_CommitWrite(). The run never
+ *           wraps, so it may be shorter than the total free space, unless the
+ *           queue was set up with Queue_InitMirrored(). On an empty queue the
+ *           slots start at the top of the buffer. Reserving does not change
+ *           the queue, so a reservation that is never committed is simply
+ *           dropped.
+ *
+ * @param pObj       Pointer to the queue object
+ * @param pNumElems  Receives the number of contiguous free slots. May be NULL.
+ *
+ * @returns Pointer to the first free slot, or NULL if the queue is full
+ ******************************************************************************/
+void *Queue_ReserveWrite(Queue_t *pObj, size_t *pNumElems);
+
+/*******************************************************************************
+ * @brief  Commit slots previously filled through Queue_ReserveWrite()
+ *
+ * @param pObj      Pointer to the queue object
+ * @param numElems  Number of slots to commit, starting at the reserved slot
+ *
+ * @returns Queue error flag. Queue_Error if more slots than were reservable.
+ ******************************************************************************/
+Queue_Error_e Queue_CommitWrite(Queue_t *pObj, size_t numElems);
+
+/*******************************************************************************
+ * @brief  Get a reference to the data on the top of the queue
+ *
+ * @details  The referenced slots stay valid until they are handed back with
+ *           Queue_Release(). The run never wraps, so it may be shorter than
+ *           the total number of queued elements, unless the queue was set up
+ *           with Queue_InitMirrored().
+ *
+ * @param pObj       Pointer to the queue object
+ * @param pNumElems  Receives the number of contiguous queued elements. May be
+ *                   NULL.
+ *
+ * @returns Pointer to the front element, or NULL if the queue is empty
+ ******************************************************************************/
+void *Queue_PeekRef(Queue_t *pObj, size_t *pNumElems);
+
+/*******************************************************************************
+ * @brief  Remove elements from the top of the queue without copying them
+ *
+ * @param pObj      Pointer to the queue object
+ * @param numElems  Number of elements to remove
+ *
+ * @returns Queue error flag. Queue_Error if fewer elements are queued.
+ ******************************************************************************/
+Queue_Error_e Queue_Release(Queue_t *pObj, size_t numElems);
+
+/*******************************************************************************
+ * @brief  Visit elements in place at the top of the queue and remove them
+ *
+ * @details  Calls pfnVisit on each element, in order, directly in the queue
+ *           buffer, then releases every visited element with a single cursor
+ *           update. The element for which pfnVisit returns false is the last
+ *           one visited and is removed along with the others. pfnVisit must not
+ *           push to or pop from the queue.
+ *
+ * @param pObj      Pointer to the queue object
+ * @param pfnVisit  Called with pCtx and a pointer to each element
+ * @param pCtx      Passed through to pfnVisit
+ * @param maxElems  Maximum number of elements to visit
+ *
+ * @returns Number of elements visited and removed
+ ******************************************************************************/
+size_t Queue_Drain(Queue_t *pObj, Queue_Drain_f pfnVisit, void *pCtx, size_t maxElems);
+
+/*******************************************************************************
+ * @brief  Take a snapshot of the queue's statistics
+ *
+ * @details  Only collected when the library is built with QUEUE_STATS
+ *           defined, so the default build carries no counters. Callers must
+ *           be built with the same setting, see Queue_t. Safe to call
+ *           from any thread while the owner keeps using the queue; each
+ *           counter is read atomically but the snapshot as a whole is not.
+ *
+ * @param pObj    Pointer to the queue object
+ * @param pStats  Receives the snapshot
+ *
+ * @returns Queue error flag. Queue_Error if built without QUEUE_STATS.
+ ******************************************************************************/
+Queue_Error_e Queue_GetStats(Queue_t *pObj, Queue_Stats_t *pStats);
+
 #endif /* QUEUE_H_INCLUDED */
\ No newline at end of file
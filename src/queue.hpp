@@ -0,0 +1,235 @@
+/*******************************************************************************
+ * @file  queue.hpp
+ *
+ * @brief C++17 typed queue
+ *
+ * @details  `queue::ring<T, N>` embeds storage for N elements and
+ *           `queue::ring<T>` manages a caller provided buffer, mirroring
+ *           Queue_Init(). Both follow Queue_t semantics (FIFO, fails instead
+ *           of blocking when full or empty) but construct elements in place
+ *           and move them in and out, so types with destructors and move-only
+ *           types such as std::unique_ptr are handled correctly. Elements
+ *           still queued when the ring is destroyed are destroyed with it.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef QUEUE_HPP_INCLUDED
+#define QUEUE_HPP_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace queue
+{
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/**
+ * @brief Capacity value selecting a ring over a caller provided buffer
+**/
+inline constexpr std::size_t dynamic_capacity = std::numeric_limits<std::size_t>::max();
+
+template <typename T, std::size_t N = dynamic_capacity>
+class ring;
+
+namespace detail
+{
+
+/**
+ * @brief  Queue logic shared by the fixed and caller buffer rings
+ *
+ * @note   The derived class owns the storage and calls clear() on destruction.
+**/
+template <typename T>
+class ring_base
+{
+public:
+    ring_base(const ring_base &) = delete;
+    ring_base &operator=(const ring_base &) = delete;
+
+    /** @returns true if empty */
+    bool empty() const noexcept { return count_ == 0; }
+
+    /** @returns true if full */
+    bool full() const noexcept { return count_ == capacity_; }
+
+    /** @returns Number of queued elements */
+    std::size_t size() const noexcept { return count_; }
+
+    /** @returns Maximum number of queued elements */
+    std::size_t capacity() const noexcept { return capacity_; }
+
+    /**
+     * @brief  Copy an element onto the queue
+     * @returns false if full
+    **/
+    bool try_push(const T &value) { return try_emplace(value); }
+
+    /**
+     * @brief  Move an element onto the queue
+     * @returns false if full, in which case value is left untouched
+    **/
+    bool try_push(T &&value) { return try_emplace(std::move(value)); }
+
+    /**
+     * @brief  Construct an element in place at the rear of the queue
+     * @returns false if full, in which case nothing is constructed
+    **/
+    template <typename... Args>
+    bool try_emplace(Args &&...args)
+    {
+        if (full())
+        {
+            return false;
+        }
+        std::size_t rear = front_ + count_;
+        if (rear >= capacity_)
+        {
+            rear -= capacity_;
+        }
+        ::new (static_cast<void *>(&slots_[rear])) T(std::forward<Args>(args)...);
+        ++count_;
+        return true;
+    }
+
+    /**
+     * @brief  Move the front element out of the queue and destroy its slot
+     * @returns false if empty
+    **/
+    bool try_pop(T &out)
+    {
+        if (empty())
+        {
+            return false;
+        }
+        T *pFront = at(front_);
+        out = std::move(*pFront);
+        std::destroy_at(pFront);
+        if (++front_ == capacity_)
+        {
+            front_ = 0;
+        }
+        --count_;
+        return true;
+    }
+
+    /** @returns Pointer to the front element, or nullptr if empty */
+    T *peek() noexcept { return empty() ? nullptr : at(front_); }
+
+    /** @returns Pointer to the front element, or nullptr if empty */
+    const T *peek() const noexcept { return empty() ? nullptr : at(front_); }
+
+    /** @brief Destroy every queued element */
+    void clear() noexcept
+    {
+        while (count_ > 0)
+        {
+            std::destroy_at(at(front_));
+            if (++front_ == capacity_)
+            {
+                front_ = 0;
+            }
+            --count_;
+        }
+        front_ = 0;
+    }
+
+protected:
+    /* Raw, suitably aligned storage for one element */
+    struct slot
+    {
+        alignas(T) unsigned char bytes[sizeof(T)];
+    };
+
+    ring_base(slot *slots, std::size_t capacity) noexcept
+        : slots_(slots), capacity_(capacity)
+    {
+    }
+
+    ~ring_base() = default;
+
+private:
+    /* Live element in a slot */
+    T *at(std::size_t index) const noexcept
+    {
+        return std::launder(reinterpret_cast<T *>(&slots_[index]));
+    }
+
+    slot       *slots_;
+    std::size_t capacity_;
+    std::size_t front_ = 0;
+    std::size_t count_ = 0;
+};
+
+} /* namespace detail */
+
+/*============================================================================*
+ *                               C L A S S E S                                *
+ *============================================================================*/
+
+/**
+ * @brief  Ring with embedded storage for N elements
+**/
+template <typename T, std::size_t N>
+class ring : public detail::ring_base<T>
+{
+    static_assert(N > 0, "ring capacity must be non-zero");
+
+    using base = detail::ring_base<T>;
+
+public:
+    ring() noexcept : base(storage_, N) {}
+    ~ring() { base::clear(); }
+
+private:
+    typename base::slot storage_[N];
+};
+
+/**
+ * @brief  Ring over a caller provided buffer
+ *
+ * @details  The caller keeps ownership of the buffer, which must outlive the
+ *           ring. The buffer start is rounded up to the alignment of T and the
+ *           capacity is however many whole elements fit in what is left.
+**/
+template <typename T>
+class ring<T, dynamic_capacity> : public detail::ring_base<T>
+{
+    using base = detail::ring_base<T>;
+
+public:
+    ring(void *pBuf, std::size_t bufSize) noexcept : ring(align(pBuf, bufSize)) {}
+    ~ring() { base::clear(); }
+
+private:
+    struct region
+    {
+        typename base::slot *slots;
+        std::size_t          capacity;
+    };
+
+    explicit ring(region r) noexcept : base(r.slots, r.capacity) {}
+
+    /* Round pBuf up to the alignment of T and count the whole slots left */
+    static region align(void *pBuf, std::size_t bufSize) noexcept
+    {
+        if (std::align(alignof(T), sizeof(T), pBuf, bufSize) == nullptr)
+        {
+            return { nullptr, 0 };
+        }
+        return { static_cast<typename base::slot *>(pBuf), bufSize / sizeof(T) };
+    }
+};
+
+} /* namespace queue */
+
+#endif /* QUEUE_HPP_INCLUDED */
@@ -0,0 +1,49 @@
+/*******************************************************************************
+ * @file  queue_alloc.c
+ *
+ * @brief Default allocator implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stdlib.h>
+
+#include "queue_alloc.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+static void *Queue_Allocator_Alloc(void *pCtx, size_t size)
+{
+    (void)pCtx;
+    return malloc(size);
+}
+
+static void *Queue_Allocator_Realloc(void *pCtx, void *pMem, size_t oldSize, size_t newSize)
+{
+    (void)pCtx;
+    (void)oldSize;
+    return realloc(pMem, newSize);
+}
+
+static void Queue_Allocator_Free(void *pCtx, void *pMem, size_t size)
+{
+    (void)pCtx;
+    (void)size;
+    free(pMem);
+}
+
+/*============================================================================*
+ *                      P U B L I C    V A R I A B L E S                      *
+ *============================================================================*/
+
+const Queue_Allocator_t Queue_Allocator_Default = {
+    .pfnAlloc = Queue_Allocator_Alloc,
+    .pfnRealloc = Queue_Allocator_Realloc,
+    .pfnFree = Queue_Allocator_Free,
+    .pCtx = NULL,
+};
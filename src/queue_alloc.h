@@ -0,0 +1,29 @@
+/*******************************************************************************
+ * @file  queue_alloc.h
+ *
+ * @brief Default allocator for queues that own their buffers
+ *
+ * @details  Internal to the queue. Used whenever a caller passes a NULL
+ *           allocator at init.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef QUEUE_ALLOC_H_INCLUDED
+#define QUEUE_ALLOC_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include "queue_t.h"
+
+/*============================================================================*
+ *                   G L O B A L    D E C L A R A T I O N S                   *
+ *============================================================================*/
+
+/**
+ * @brief Allocator backed by malloc(), realloc() and free()
+**/
+extern const Queue_Allocator_t Queue_Allocator_Default;
+
+#endif /* QUEUE_ALLOC_H_INCLUDED */
@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * @file  queue_batch.c
+ *
+ * @brief Adaptive batching consumer implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include "queue_batch.h"
+#include "queue_spsc.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/* CLOCK_MONOTONIC in nanoseconds */
+static inline uint64_t QueueBatch_Now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+/* Convert nanoseconds on CLOCK_MONOTONIC back into a timespec deadline */
+static inline struct timespec QueueBatch_Timespec(uint64_t ns)
+{
+    return (struct timespec){ .tv_sec = (time_t)(ns / 1000000000u),
+                              .tv_nsec = (long)(ns % 1000000000u) };
+}
+
+/* Estimate how many elements arrive within one budget from the last batch */
+static uint64_t QueueBatch_Sample(QueueBatch_t *pObj, size_t numElems, uint64_t start)
+{
+    uint64_t intervalNs = start - pObj->lastStartNs;
+    bool first = (pObj->lastStartNs == 0);
+    pObj->lastStartNs = start;
+
+    /* Filled with a backlog left behind, so the consumer is falling behind */
+    if (numElems == pObj->target && !QueueSpsc_IsEmpty(pObj->pQueue))
+    {
+        return 2 * (uint64_t)numElems;
+    }
+    if (first || intervalNs == 0)
+    {
+        return numElems;
+    }
+
+    /* The consumer kept up, so this batch is everything that arrived since
+     * the previous one started */
+    if (intervalNs * pObj->maxBatch < pObj->budgetNs * numElems)
+    {
+        return pObj->maxBatch;
+    }
+
+    return numElems * pObj->budgetNs / intervalNs;
+}
+
+/* Fold one sample into the arrival rate estimate and retune the target */
+static void QueueBatch_Update(QueueBatch_t *pObj, uint64_t arrivals)
+{
+    uint64_t sample = arrivals << QUEUE_BATCH_RATE_SHIFT;
+
+    if (sample >= pObj->rate)
+    {
+        pObj->rate += (sample - pObj->rate) >> QUEUE_BATCH_EWMA_SHIFT;
+    }
+    else
+    {
+        pObj->rate -= (pObj->rate - sample) >> QUEUE_BATCH_EWMA_SHIFT;
+    }
+
+    /* Round to the nearest element and clamp */
+    size_t target = (size_t)((pObj->rate + (1u << (QUEUE_BATCH_RATE_SHIFT - 1))) >> QUEUE_BATCH_RATE_SHIFT);
+    if (target < pObj->minBatch)
+    {
+        target = pObj->minBatch;
+    }
+    else if (target > pObj->maxBatch)
+    {
+        target = pObj->maxBatch;
+    }
+    pObj->target = target;
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Queue_Error_e QueueBatch_Init(QueueBatch_t *pObj, QueueSpsc_t *pQueue, size_t minBatch,
+                              size_t maxBatch, const struct timespec *pBudget)
+{
+    if (pQueue == NULL || pBudget == NULL || minBatch == 0 || maxBatch < minBatch ||
+        maxBatch > (SIZE_MAX >> QUEUE_BATCH_RATE_SHIFT))
+    {
+        return Queue_Error;
+    }
+    pObj->pQueue = pQueue;
+    pObj->minBatch = minBatch;
+    pObj->maxBatch = maxBatch;
+    pObj->target = minBatch;
+    pObj->budgetNs = (uint64_t)pBudget->tv_sec * 1000000000u + (uint64_t)pBudget->tv_nsec;
+    pObj->rate = (uint64_t)minBatch << QUEUE_BATCH_RATE_SHIFT;
+    pObj->lastStartNs = 0;
+
+    return Queue_Error_None;
+}
+
+size_t QueueBatch_Pop(QueueBatch_t *pObj, void *pDataOutVoid, const struct timespec *pTimeout)
+{
+    uint8_t *pDataOut = pDataOutVoid;
+    size_t dataSize = pObj->pQueue->dataSize;
+
+    if (QueueSpsc_PopWait(pObj->pQueue, pDataOut, pTimeout) != Queue_Error_None)
+    {
+        return 0;
+    }
+    uint64_t start = QueueBatch_Now();
+    struct timespec deadline = QueueBatch_Timespec(start + pObj->budgetNs);
+
+    /* Take whatever is already queued, and only park once it runs dry */
+    size_t numElems = 1;
+    while (numElems < pObj->target)
+    {
+        uint8_t *pSlot = &pDataOut[numElems * dataSize];
+        if (QueueSpsc_Pop(pObj->pQueue, pSlot) != Queue_Error_None &&
+            QueueSpsc_PopWaitUntil(pObj->pQueue, pSlot, &deadline) != Queue_Error_None)
+        {
+            break;
+        }
+        numElems++;
+    }
+
+    QueueBatch_Update(pObj, QueueBatch_Sample(pObj, numElems, start));
+
+    return numElems;
+}
+
+size_t QueueBatch_Target(QueueBatch_t *pObj)
+{
+    return pObj->target;
+}
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * @file  queue_batch.h
+ *
+ * @brief Adaptive batching consumer public function declarations
+ *
+ * @details  Pops elements off a QueueSpsc_t in batches for consumers whose
+ *           per-batch cost (syscalls, compression) dominates. A batch is
+ *           returned once it reaches the current target or once the latency
+ *           budget since its first element has expired, whichever comes
+ *           first. The target follows the observed arrival rate: it grows
+ *           while batches fill before the budget expires and shrinks while
+ *           they time out. Consumer only.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef QUEUE_BATCH_H_INCLUDED
+#define QUEUE_BATCH_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <time.h>
+
+#include "queue_batch_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Initializes the batching consumer
+ *
+ * @details  The batch target starts at minBatch.
+ *
+ * @param pObj      Pointer to the batching consumer object
+ * @param pQueue    Pointer to an initialized SPSC queue
+ * @param minBatch  Smallest batch target. Must be non-zero.
+ * @param maxBatch  Largest batch target. Must be at least minBatch.
+ * @param pBudget   Latency budget from the first element of a batch
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueBatch_Init(QueueBatch_t *pObj, QueueSpsc_t *pQueue, size_t minBatch,
+                              size_t maxBatch, const struct timespec *pBudget);
+
+/*******************************************************************************
+ * @brief  Pops a batch of data types off the queue
+ *
+ * @details  Waits up to pTimeout for the first element, then keeps popping
+ *           until the batch target is reached or the latency budget expires.
+ *           The budget is measured from when the first element was popped.
+ *
+ * @param pObj          Pointer to the batching consumer object
+ * @param pDataOutVoid  Pointer to an array of at least maxBatch elements
+ * @param pTimeout      Relative timeout for the first element, or NULL to wait
+ *                      forever
+ *
+ * @returns Number of elements popped. 0 if the timeout expired.
+ ******************************************************************************/
+size_t QueueBatch_Pop(QueueBatch_t *pObj, void *pDataOutVoid, const struct timespec *pTimeout);
+
+/*******************************************************************************
+ * @brief  Get the current batch target
+ *
+ * @param pObj  Pointer to the batching consumer object
+ *
+ * @returns Number of elements the next batch aims for
+ ******************************************************************************/
+size_t QueueBatch_Target(QueueBatch_t *pObj);
+
+#endif /* QUEUE_BATCH_H_INCLUDED */
@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * @file  queue_batch_t.h
+ *
+ * @brief Adaptive batching consumer type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef QUEUE_BATCH_T_H_INCLUDED
+#define QUEUE_BATCH_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "queue_spsc_t.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/**
+ * @brief Weight of a new arrival rate sample is 1 / 2^QUEUE_BATCH_EWMA_SHIFT
+**/
+#ifndef QUEUE_BATCH_EWMA_SHIFT
+#define QUEUE_BATCH_EWMA_SHIFT 3
+#endif
+
+/**
+ * @brief Fractional bits kept in the arrival rate estimate
+**/
+#define QUEUE_BATCH_RATE_SHIFT 8
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Adaptive batching consumer object
+ *
+ * @details  Sits on the consumer side of a QueueSpsc_t. The batch target is
+ *           an exponentially weighted moving average of how many elements
+ *           arrive within one latency budget, clamped to
+ *           [minBatch, maxBatch]. Arrivals are measured between the starts of
+ *           consecutive batches, and doubled while a backlog is left behind.
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _QueueBatch_t
+{
+    QueueSpsc_t *pQueue;      /*!< Queue being consumed */
+    size_t       minBatch;    /*!< Smallest batch target */
+    size_t       maxBatch;    /*!< Largest batch target, and capacity of the caller's array */
+    size_t       target;      /*!< Current batch target */
+    uint64_t     budgetNs;    /*!< Latency budget measured from the first element of a batch */
+    uint64_t     rate;        /*!< Arrivals per budget, with QUEUE_BATCH_RATE_SHIFT fraction bits */
+    uint64_t     lastStartNs; /*!< When the previous batch got its first element, 0 if none */
+} QueueBatch_t;
+
+#endif /* QUEUE_BATCH_T_H_INCLUDED */
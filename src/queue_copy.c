@@ -0,0 +1,114 @@
+/*******************************************************************************
+ * @file  queue_copy.c
+ *
+ * @brief Element copy routines specialized by data size
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <string.h>
+
+#include "queue_copy.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define QUEUE_COPY_X86
+#include <immintrin.h>
+#endif
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/* Fixed size copies compile down to one or two register moves */
+static void Queue_Copy_1(void *pDst, const void *pSrc, size_t size)
+{
+    (void)size;
+    memcpy(pDst, pSrc, 1);
+}
+
+static void Queue_Copy_2(void *pDst, const void *pSrc, size_t size)
+{
+    (void)size;
+    memcpy(pDst, pSrc, 2);
+}
+
+static void Queue_Copy_4(void *pDst, const void *pSrc, size_t size)
+{
+    (void)size;
+    memcpy(pDst, pSrc, 4);
+}
+
+static void Queue_Copy_8(void *pDst, const void *pSrc, size_t size)
+{
+    (void)size;
+    memcpy(pDst, pSrc, 8);
+}
+
+static void Queue_Copy_16(void *pDst, const void *pSrc, size_t size)
+{
+    (void)size;
+    memcpy(pDst, pSrc, 16);
+}
+
+static void Queue_Copy_Generic(void *pDst, const void *pSrc, size_t size)
+{
+    memcpy(pDst, pSrc, size);
+}
+
+#ifdef QUEUE_COPY_X86
+/* Size is a multiple of 16 */
+__attribute__((target("sse2")))
+static void Queue_Copy_Sse2(void *pDst, const void *pSrc, size_t size)
+{
+    for (size_t byte = 0; byte < size; byte += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)((const uint8_t *)pSrc + byte));
+        _mm_storeu_si128((__m128i *)((uint8_t *)pDst + byte), v);
+    }
+}
+
+/* Size is a multiple of 32 */
+__attribute__((target("avx2")))
+static void Queue_Copy_Avx2(void *pDst, const void *pSrc, size_t size)
+{
+    for (size_t byte = 0; byte < size; byte += 32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)((const uint8_t *)pSrc + byte));
+        _mm256_storeu_si256((__m256i *)((uint8_t *)pDst + byte), v);
+    }
+}
+#endif /* QUEUE_COPY_X86 */
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Queue_Copy_f Queue_Copy_Select(size_t dataSize)
+{
+    switch (dataSize)
+    {
+        case 1:  return Queue_Copy_1;
+        case 2:  return Queue_Copy_2;
+        case 4:  return Queue_Copy_4;
+        case 8:  return Queue_Copy_8;
+        case 16: return Queue_Copy_16;
+        default: break;
+    }
+
+#ifdef QUEUE_COPY_X86
+    __builtin_cpu_init();
+    if (dataSize % 32 == 0 && __builtin_cpu_supports("avx2"))
+    {
+        return Queue_Copy_Avx2;
+    }
+    if (dataSize % 16 == 0 && __builtin_cpu_supports("sse2"))
+    {
+        return Queue_Copy_Sse2;
+    }
+#endif
+
+    return Queue_Copy_Generic;
+}
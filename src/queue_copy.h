@@ -0,0 +1,40 @@
+/*******************************************************************************
+ * @file  queue_copy.h
+ *
+ * @brief Element copy routines specialized by data size
+ *
+ * @details  Internal to the queue. Queue_Init() picks one routine per queue
+ *           so that Push/Pop/Peek do not run a generic byte loop for every
+ *           element.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef QUEUE_COPY_H_INCLUDED
+#define QUEUE_COPY_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+
+#include "queue_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Select the fastest copy routine for a data size on this CPU
+ *
+ * @details  1, 2, 4, 8 and 16 byte elements get fixed size moves. Larger
+ *           multiples of 32 or 16 bytes get AVX2 or SSE2 loops when the CPU
+ *           supports them. Everything else falls back to memcpy().
+ *
+ * @param dataSize  Size of the data type that the queue is handling
+ *
+ * @returns Copy routine
+ ******************************************************************************/
+Queue_Copy_f Queue_Copy_Select(size_t dataSize);
+
+#endif /* QUEUE_COPY_H_INCLUDED */
@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * @file  queue_event.c
+ *
+ * @brief Queue readiness notification implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+#include "queue.h"
+#include "queue_event.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/* Make an eventfd readable. Its counter only matters as zero or non-zero. */
+static void Queue_EventSignal(int fd)
+{
+    uint64_t one = 1;
+    ssize_t rc = write(fd, &one, sizeof(one));
+    (void)rc;
+}
+
+/* Reset an eventfd to not readable */
+static void Queue_EventClear(int fd)
+{
+    uint64_t value;
+    ssize_t rc = read(fd, &value, sizeof(value));
+    (void)rc;
+}
+
+static void Queue_EventPushed(Queue_t *pObj, size_t numElems)
+{
+    Queue_Event_t *pEvent = (Queue_Event_t *)pObj->pHooks;
+
+    /* Everything queued was just pushed, so this was empty to non-empty */
+    if (Queue_Count(pObj) == numElems)
+    {
+        Queue_EventSignal(pEvent->readFd);
+    }
+    if (Queue_IsFull(pObj))
+    {
+        Queue_EventClear(pEvent->writeFd);
+    }
+}
+
+static void Queue_EventPopped(Queue_t *pObj, size_t numElems)
+{
+    Queue_Event_t *pEvent = (Queue_Event_t *)pObj->pHooks;
+
+    if (Queue_IsEmpty(pObj))
+    {
+        Queue_EventClear(pEvent->readFd);
+    }
+    if (Queue_Count(pObj) + numElems == pObj->bufSize / pObj->dataSize)
+    {
+        Queue_EventSignal(pEvent->writeFd);
+    }
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Queue_Error_e Queue_EventOpen(Queue_t *pObj, Queue_Event_t *pEvent)
+{
+    if (pObj->pHooks != NULL)
+    {
+        return Queue_Error;
+    }
+
+    /* Start each counter at 1 if its side is already ready */
+    pEvent->readFd = eventfd(Queue_IsEmpty(pObj) ? 0 : 1, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (pEvent->readFd < 0)
+    {
+        return Queue_Error;
+    }
+    pEvent->writeFd = eventfd(Queue_IsFull(pObj) ? 0 : 1, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (pEvent->writeFd < 0)
+    {
+        close(pEvent->readFd);
+        return Queue_Error;
+    }
+    pEvent->hooks.pfnPushed = Queue_EventPushed;
+    pEvent->hooks.pfnPopped = Queue_EventPopped;
+    pObj->pHooks = &pEvent->hooks;
+
+    return Queue_Error_None;
+}
+
+void Queue_EventClose(Queue_t *pObj)
+{
+    Queue_Event_t *pEvent = (Queue_Event_t *)pObj->pHooks;
+
+    if (pEvent != NULL)
+    {
+        close(pEvent->readFd);
+        close(pEvent->writeFd);
+        pEvent->readFd = -1;
+        pEvent->writeFd = -1;
+    }
+    pObj->pHooks = NULL;
+}
+
+int Queue_EventReadFd(Queue_t *pObj)
+{
+    return (pObj->pHooks != NULL) ? ((Queue_Event_t *)pObj->pHooks)->readFd : -1;
+}
+
+int Queue_EventWriteFd(Queue_t *pObj)
+{
+    return (pObj->pHooks != NULL) ? ((Queue_Event_t *)pObj->pHooks)->writeFd : -1;
+}
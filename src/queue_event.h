@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * @file  queue_event.h
+ *
+ * @brief Queue readiness notification public function declarations
+ *
+ * @details  Attaches a pair of eventfds to a Queue_t so that event loops can
+ *           multiplex queues alongside sockets with epoll instead of polling.
+ *           Both are watched for EPOLLIN:
+ *
+ *           - the read fd is readable while the queue holds elements
+ *           - the write fd is readable while the queue has free slots
+ *
+ *           Each fd is only written on the transition into its ready state
+ *           (empty to non-empty, full to not-full) and cleared on the
+ *           transition out of it, so any number of pushes or pops coalesce into
+ *           one wakeup and the steady state costs no syscalls. The caller never
+ *           reads the fds. Linux only (eventfd).
+ *
+ *           Queue_t is single threaded, and so is this. The producer, the
+ *           consumer and the epoll loop watching the fds must all run on one
+ *           thread, typically as handlers of that loop. The transitions are
+ *           read from the queue's own count right after each push or pop,
+ *           which is only exact when nothing else moves the queue meanwhile.
+ *           Cross-thread handoff belongs to QueueSpsc_t, whose futex
+ *           waits already block the consumer without an fd.
+ *
+ *           Queue_Init() and Queue_InitEx() detach without closing anything,
+ *           so call Queue_EventClose() before re-initialising a queue that
+ *           has eventfds attached.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef QUEUE_EVENT_H_INCLUDED
+#define QUEUE_EVENT_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include "queue_event_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Attaches readiness eventfds to an initialized queue
+ *
+ * @details  The fds start out matching the current queue state.
+ *
+ * @param pObj    Pointer to the queue object
+ * @param pEvent  Caller allocated storage for the eventfds, which must outlive
+ *                the attachment
+ *
+ * @returns Queue error flag. Queue_Error if hooks are already attached or the
+ *          eventfds could not be created.
+ ******************************************************************************/
+Queue_Error_e Queue_EventOpen(Queue_t *pObj, Queue_Event_t *pEvent);
+
+/*******************************************************************************
+ * @brief  Closes the readiness eventfds, if any
+ *
+ * @param pObj  Pointer to the queue object
+ ******************************************************************************/
+void Queue_EventClose(Queue_t *pObj);
+
+/*******************************************************************************
+ * @brief  Get the fd that is readable while the queue is not empty
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns eventfd, or -1 if not attached
+ ******************************************************************************/
+int Queue_EventReadFd(Queue_t *pObj);
+
+/*******************************************************************************
+ * @brief  Get the fd that is readable while the queue is not full
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns eventfd, or -1 if not attached
+ ******************************************************************************/
+int Queue_EventWriteFd(Queue_t *pObj);
+
+#endif /* QUEUE_EVENT_H_INCLUDED */
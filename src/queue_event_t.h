@@ -0,0 +1,35 @@
+/*******************************************************************************
+ * @file  queue_event_t.h
+ *
+ * @brief Queue readiness notification type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef QUEUE_EVENT_T_H_INCLUDED
+#define QUEUE_EVENT_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include "queue_t.h"
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Readiness eventfds attached to a Queue_t
+ *
+ * @details  The caller allocates this object, which must outlive the
+ *           attachment. The queue reaches it through Queue_t::pHooks.
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _Queue_Event_t
+{
+    Queue_Hooks_t hooks;   /*!< Must stay first, the queue only sees this */
+    int           readFd;  /*!< eventfd readable while not empty */
+    int           writeFd; /*!< eventfd readable while not full */
+} Queue_Event_t;
+
+#endif /* QUEUE_EVENT_T_H_INCLUDED */
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * @file  queue_fd.c
+ *
+ * @brief Queue file descriptor output implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <errno.h>
+#include <sys/uio.h>
+
+#include "queue.h"
+#include "queue_fd.h"
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+ssize_t Queue_WriteToFd(Queue_t *pObj, int fd, size_t maxElems)
+{
+    /* An overwrite could drop the element a partial write is part way through */
+    if (pObj->flags & Queue_Flag_Overwrite)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    size_t runElems;
+    uint8_t *pRun = Queue_PeekRef(pObj, &runElems);
+    size_t numElems = Queue_Count(pObj);
+
+    if (maxElems < numElems)
+    {
+        numElems = maxElems;
+    }
+    if (pRun == NULL || numElems == 0)
+    {
+        return 0;
+    }
+    if (runElems > numElems)
+    {
+        runElems = numElems;
+    }
+
+    /* The run up to the end of the buffer, then the run from its start,
+     * skipping whatever a previous partial write already sent */
+    struct iovec iov[2];
+    int iovCount = 1;
+    iov[0].iov_base = pRun + pObj->fdOffset;
+    iov[0].iov_len = runElems * pObj->dataSize - pObj->fdOffset;
+    if (numElems > runElems)
+    {
+        iov[1].iov_base = pObj->pBuf;
+        iov[1].iov_len = (numElems - runElems) * pObj->dataSize;
+        iovCount = 2;
+    }
+
+    ssize_t written = writev(fd, iov, iovCount);
+    if (written < 0)
+    {
+        return -1;
+    }
+
+    /* Remove whole elements, and remember how far into the next one we got */
+    size_t sent = pObj->fdOffset + (size_t)written;
+    size_t whole = sent / pObj->dataSize;
+    Queue_Release(pObj, whole);
+    pObj->fdOffset = sent % pObj->dataSize;
+
+    return (ssize_t)whole;
+}
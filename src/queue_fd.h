@@ -0,0 +1,51 @@
+/*******************************************************************************
+ * @file  queue_fd.h
+ *
+ * @brief Queue file descriptor output public function declarations
+ *
+ * @details  Writes queued elements straight from the queue buffer to a file
+ *           descriptor, without staging them in a separate buffer first.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef QUEUE_FD_H_INCLUDED
+#define QUEUE_FD_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <sys/types.h>
+
+#include "queue_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Writes elements from the top of the queue to a file descriptor
+ *
+ * @details  Issues a single writev() of at most two iovecs, one up to the end
+ *           of the buffer and one from its start, or one for a queue set up
+ *           with Queue_InitMirrored(). Elements written in full are removed
+ *           from the queue. If the write stops part way through an element,
+ *           that element stays queued and the next call resumes after the
+ *           bytes already sent. Popping or releasing it instead discards the
+ *           partial progress.
+ *
+ *           Queues initialized with Queue_Flag_Overwrite are rejected, since
+ *           an overwriting push could drop an element that has only been
+ *           partly written and leave a truncated record in the output.
+ *
+ * @param pObj      Pointer to the queue object
+ * @param fd        File descriptor to write to. May be non-blocking.
+ * @param maxElems  Maximum number of elements to write
+ *
+ * @returns Number of whole elements written and removed, or -1 with errno
+ *          set if writev() failed, or EINVAL for a Queue_Flag_Overwrite queue
+ ******************************************************************************/
+ssize_t Queue_WriteToFd(Queue_t *pObj, int fd, size_t maxElems);
+
+#endif /* QUEUE_FD_H_INCLUDED */
@@ -0,0 +1,341 @@
+/*******************************************************************************
+ * @file  queue_file.c
+ *
+ * @brief Durable file-backed queue implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <errno.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "queue_file.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+_Static_assert(sizeof(QueueFile_Header_t) <= QUEUE_FILE_HEADER_SIZE,
+               "queue file header does not fit in its reserved space");
+
+#define QUEUE_FILE_FNV_OFFSET  UINT32_C(2166136261)
+#define QUEUE_FILE_FNV_PRIME   UINT32_C(16777619)
+
+/* FNV-1a, continued from hash */
+static uint32_t QueueFile_Fnv(uint32_t hash, const void *pData, size_t size)
+{
+    const uint8_t *pBytes = pData;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ pBytes[i]) * QUEUE_FILE_FNV_PRIME;
+    }
+    return hash;
+}
+
+/* Checksum over the fixed header fields */
+static uint32_t QueueFile_HeaderChecksum(const QueueFile_Header_t *pHdr)
+{
+    return QueueFile_Fnv(QUEUE_FILE_FNV_OFFSET, pHdr, offsetof(QueueFile_Header_t, checksum));
+}
+
+/* Checksum over a slot's sequence number and element */
+static uint32_t QueueFile_SlotChecksum(QueueFile_t *pObj, uint64_t seq, const void *pData)
+{
+    return QueueFile_Fnv(QueueFile_Fnv(QUEUE_FILE_FNV_OFFSET, &seq, sizeof(seq)), pData, pObj->dataSize);
+}
+
+/* Slot that holds element seq. Layout: u64 seq, u32 checksum, u32 pad, data. */
+static inline uint8_t *QueueFile_Slot(QueueFile_t *pObj, uint64_t seq)
+{
+    return &pObj->pSlots[(size_t)(seq % pObj->capacity) * pObj->slotSize];
+}
+
+/* True if the slot for seq holds a complete write of element seq */
+static bool QueueFile_SlotIsValid(QueueFile_t *pObj, uint64_t seq)
+{
+    uint8_t *pSlot = QueueFile_Slot(pObj, seq);
+    uint64_t slotSeq;
+    uint32_t checksum;
+
+    memcpy(&slotSeq, pSlot, sizeof(slotSeq));
+    memcpy(&checksum, pSlot + 8, sizeof(checksum));
+
+    return (slotSeq == seq && checksum == QueueFile_SlotChecksum(pObj, seq, pSlot + 16));
+}
+
+/* Flush if the sync policy says one is due */
+static Queue_Error_e QueueFile_Committed(QueueFile_t *pObj)
+{
+    if (pObj->config.syncMode == QueueFile_Sync_None || pObj->config.syncEvery == 0)
+    {
+        return Queue_Error_None;
+    }
+    if (++pObj->unsynced < pObj->config.syncEvery)
+    {
+        return Queue_Error_None;
+    }
+    return QueueFile_Sync(pObj);
+}
+
+/* Build the header for a new file */
+static void QueueFile_Format(QueueFile_Header_t *pHdr, size_t capacity, size_t dataSize)
+{
+    memset(pHdr, 0, sizeof(*pHdr));
+    pHdr->magic = QUEUE_FILE_MAGIC;
+    pHdr->version = QUEUE_FILE_VERSION;
+    pHdr->dataSize = dataSize;
+    pHdr->capacity = capacity;
+    pHdr->checksum = QueueFile_HeaderChecksum(pHdr);
+}
+
+/* File size for capacity slots, or 0 if it cannot be mapped or addressed
+ * through off_t */
+static size_t QueueFile_MapSize(size_t capacity, size_t slotSize)
+{
+    uint64_t offMax = (sizeof(off_t) >= sizeof(int64_t)) ? INT64_MAX : INT32_MAX;
+
+    if (capacity == 0 || capacity > (SIZE_MAX - QUEUE_FILE_HEADER_SIZE) / slotSize)
+    {
+        return 0;
+    }
+    size_t mapSize = QUEUE_FILE_HEADER_SIZE + capacity * slotSize;
+
+    return ((uint64_t)mapSize <= offMax) ? mapSize : 0;
+}
+
+/* Close the file on a failed open, and remove it if this open created it */
+static Queue_Error_e QueueFile_Abandon(QueueFile_t *pObj, const char *pPath, bool created)
+{
+    close(pObj->fd);
+    pObj->fd = -1;
+    if (created)
+    {
+        unlink(pPath);
+    }
+    return Queue_Error;
+}
+
+/* Rebuild the cursors from the slots, discarding anything torn */
+static void QueueFile_Recover(QueueFile_t *pObj)
+{
+    QueueFile_Header_t *pHdr = pObj->pHdr;
+
+    /* The header and the slots reach the disk in any order, so the header's
+     * front may be older than the slots. Element seq can only have been
+     * written once seq - capacity was popped, so the newest valid slot
+     * bounds how far the front must have got. */
+    for (size_t index = 0; index < pObj->capacity; index++)
+    {
+        uint64_t slotSeq;
+        memcpy(&slotSeq, QueueFile_Slot(pObj, index), sizeof(slotSeq));
+        if (slotSeq >= pHdr->front + pObj->capacity && slotSeq % pObj->capacity == index &&
+            QueueFile_SlotIsValid(pObj, slotSeq))
+        {
+            pHdr->front = slotSeq + 1 - pObj->capacity;
+        }
+    }
+
+    uint64_t rear = pHdr->front;
+
+    while (rear - pHdr->front < pObj->capacity && QueueFile_SlotIsValid(pObj, rear))
+    {
+        rear++;
+    }
+    pHdr->rear = rear;
+
+    /* Writes that landed after the torn one must not resurface once the
+     * slots before them are reused */
+    for (uint64_t seq = rear + 1; seq - pHdr->front < pObj->capacity; seq++)
+    {
+        uint8_t *pSlot = QueueFile_Slot(pObj, seq);
+        uint64_t slotSeq;
+        memcpy(&slotSeq, pSlot, sizeof(slotSeq));
+        if (slotSeq == seq)
+        {
+            memset(pSlot, 0xFF, sizeof(slotSeq));
+        }
+    }
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Queue_Error_e QueueFile_Open(QueueFile_t *pObj, const char *pPath, size_t capacity,
+                             size_t dataSize, const QueueFile_Config_t *pConfig)
+{
+    static const QueueFile_Header_t zeroHdr;
+    size_t slotSize = QUEUE_FILE_SLOT_SIZE(dataSize);
+
+    if (dataSize == 0 || dataSize > SIZE_MAX / 2 ||
+        (capacity != 0 && QueueFile_MapSize(capacity, slotSize) == 0))
+    {
+        return Queue_Error;
+    }
+
+    /* Only create the file when there is a capacity to give it */
+    bool created = false;
+    pObj->fd = open(pPath, O_RDWR | O_CLOEXEC);
+    if (pObj->fd == -1 && errno == ENOENT && capacity != 0)
+    {
+        pObj->fd = open(pPath, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+        created = (pObj->fd != -1);
+    }
+    if (pObj->fd == -1)
+    {
+        return Queue_Error;
+    }
+
+    /* A file whose header never reached the disk is treated as new, so a
+     * crash during creation leaves it reusable rather than unopenable */
+    struct stat st;
+    QueueFile_Header_t hdr = zeroHdr;
+    ssize_t hdrRead = pread(pObj->fd, &hdr, sizeof(hdr), 0);
+    if (hdrRead < 0 || fstat(pObj->fd, &st) != 0)
+    {
+        return QueueFile_Abandon(pObj, pPath, created);
+    }
+    bool isNew = (memcmp(&hdr, &zeroHdr, sizeof(hdr)) == 0);
+
+    /* Size a new file from the arguments, or an existing one from its header */
+    if (!isNew)
+    {
+        if (hdrRead != (ssize_t)sizeof(hdr) ||
+            hdr.magic != QUEUE_FILE_MAGIC || hdr.version != QUEUE_FILE_VERSION ||
+            hdr.checksum != QueueFile_HeaderChecksum(&hdr) || hdr.dataSize != dataSize ||
+            hdr.capacity == 0 || (capacity != 0 && hdr.capacity != capacity) ||
+            hdr.capacity > SIZE_MAX)
+        {
+            return QueueFile_Abandon(pObj, pPath, created);
+        }
+        capacity = (size_t)hdr.capacity;
+    }
+
+    size_t mapSize = QueueFile_MapSize(capacity, slotSize);
+    if (mapSize == 0 || (!isNew && (uint64_t)st.st_size < mapSize))
+    {
+        return QueueFile_Abandon(pObj, pPath, created);
+    }
+
+    /* Size the file and make the header durable before anything can be
+     * pushed, so the slots never reach the disk ahead of it */
+    if (isNew)
+    {
+        QueueFile_Format(&hdr, capacity, dataSize);
+        if (ftruncate(pObj->fd, (off_t)mapSize) != 0 ||
+            pwrite(pObj->fd, &hdr, sizeof(hdr), 0) != (ssize_t)sizeof(hdr) ||
+            fsync(pObj->fd) != 0)
+        {
+            return QueueFile_Abandon(pObj, pPath, created);
+        }
+    }
+
+    uint8_t *pMap = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, pObj->fd, 0);
+    if (pMap == MAP_FAILED)
+    {
+        return QueueFile_Abandon(pObj, pPath, created);
+    }
+
+    pObj->pHdr = (QueueFile_Header_t *)pMap;
+    pObj->pSlots = pMap + QUEUE_FILE_HEADER_SIZE;
+    pObj->mapSize = mapSize;
+    pObj->slotSize = slotSize;
+    pObj->capacity = capacity;
+    pObj->dataSize = dataSize;
+    pObj->config = (pConfig != NULL) ? *pConfig
+                                     : (QueueFile_Config_t){ .syncMode = QueueFile_Sync_None };
+    pObj->unsynced = 0;
+
+    if (!isNew)
+    {
+        QueueFile_Recover(pObj);
+    }
+
+    return Queue_Error_None;
+}
+
+void QueueFile_Close(QueueFile_t *pObj)
+{
+    QueueFile_Sync(pObj);
+    munmap(pObj->pHdr, pObj->mapSize);
+    close(pObj->fd);
+    pObj->pHdr = NULL;
+    pObj->pSlots = NULL;
+    pObj->fd = -1;
+}
+
+Queue_Error_e QueueFile_Sync(QueueFile_t *pObj)
+{
+    int rc = (pObj->config.syncMode == QueueFile_Sync_Fdatasync)
+           ? fdatasync(pObj->fd)
+           : msync(pObj->pHdr, pObj->mapSize, MS_SYNC);
+
+    pObj->unsynced = 0;
+
+    return (rc == 0) ? Queue_Error_None : Queue_Error;
+}
+
+bool QueueFile_IsEmpty(QueueFile_t *pObj)
+{
+    return (pObj->pHdr->rear == pObj->pHdr->front);
+}
+
+bool QueueFile_IsFull(QueueFile_t *pObj)
+{
+    return (pObj->pHdr->rear - pObj->pHdr->front == pObj->capacity);
+}
+
+size_t QueueFile_Count(QueueFile_t *pObj)
+{
+    return (size_t)(pObj->pHdr->rear - pObj->pHdr->front);
+}
+
+Queue_Error_e QueueFile_Push(QueueFile_t *pObj, void *pDataInVoid)
+{
+    if (QueueFile_IsFull(pObj))
+    {
+        return Queue_Error;
+    }
+
+    /* Fill and stamp the slot, then advance the cursor */
+    uint64_t seq = pObj->pHdr->rear;
+    uint8_t *pSlot = QueueFile_Slot(pObj, seq);
+    uint32_t checksum = QueueFile_SlotChecksum(pObj, seq, pDataInVoid);
+    memcpy(pSlot + 16, pDataInVoid, pObj->dataSize);
+    memcpy(pSlot + 8, &checksum, sizeof(checksum));
+    memcpy(pSlot, &seq, sizeof(seq));
+    pObj->pHdr->rear = seq + 1;
+
+    return QueueFile_Committed(pObj);
+}
+
+Queue_Error_e QueueFile_Pop(QueueFile_t *pObj, void *pDataOutVoid)
+{
+    if (QueueFile_Peek(pObj, pDataOutVoid) != Queue_Error_None)
+    {
+        return Queue_Error;
+    }
+    pObj->pHdr->front++;
+
+    return QueueFile_Committed(pObj);
+}
+
+Queue_Error_e QueueFile_Peek(QueueFile_t *pObj, void *pDataOutVoid)
+{
+    if (QueueFile_IsEmpty(pObj))
+    {
+        return Queue_Error;
+    }
+
+    /* Copy the data out without updating object state */
+    memcpy(pDataOutVoid, QueueFile_Slot(pObj, pObj->pHdr->front) + 16, pObj->dataSize);
+
+    return Queue_Error_None;
+}
@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * @file  queue_file.h
+ *
+ * @brief Durable file-backed queue public function declarations
+ *
+ * @details  Fixed-capacity queue whose header and slots live in a memory
+ *           mapped file, so queued elements survive a crash of the process
+ *           and, once flushed, of the machine. Opening an existing file
+ *           validates its header and recovers the queue by scanning from the
+ *           front, stopping at the first slot that is missing or torn. A
+ *           front cursor that reached the disk later than the slots is
+ *           moved past every slot that was already reused. Elements popped
+ *           since the last flush may be delivered again, but unpopped ones
+ *           are never lost.
+ *
+ * @note   Not thread-safe, and only one process may have a file open.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef QUEUE_FILE_H_INCLUDED
+#define QUEUE_FILE_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "queue_file_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Opens or creates a queue file and maps it
+ *
+ * @details  A missing file is created with `capacity` slots, and so is one
+ *           whose header is still all zero because an earlier creation did
+ *           not finish. The header is written and synced before the file is
+ *           mapped. An existing file must have a valid header and the same
+ *           dataSize; its committed elements are recovered and any torn
+ *           writes past the last good slot are discarded. A failed open
+ *           removes the file if it created it.
+ *
+ * @param pObj      Pointer to the queue object
+ * @param pPath     Path of the queue file
+ * @param capacity  Number of slots for a new file. 0 accepts the capacity of
+ *                  an existing file and never creates one, otherwise it must
+ *                  match.
+ * @param dataSize  Size of the data type that the queue is handling
+ * @param pConfig   Sync policy, copied into the object. NULL never flushes
+ *                  automatically.
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueFile_Open(QueueFile_t *pObj, const char *pPath, size_t capacity,
+                             size_t dataSize, const QueueFile_Config_t *pConfig);
+
+/*******************************************************************************
+ * @brief  Flushes, unmaps and closes the queue file
+ *
+ * @param pObj  Pointer to the queue object
+ ******************************************************************************/
+void QueueFile_Close(QueueFile_t *pObj);
+
+/*******************************************************************************
+ * @brief  Flushes every committed operation to storage
+ *
+ * @details  Uses the configured sync mode, or msync() if it is
+ *           QueueFile_Sync_None.
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueFile_Sync(QueueFile_t *pObj);
+
+/*******************************************************************************
+ * @brief  Check if the queue is empty
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns true if empty
+ ******************************************************************************/
+bool QueueFile_IsEmpty(QueueFile_t *pObj);
+
+/*******************************************************************************
+ * @brief Check if the queue is full
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns true if full
+ ******************************************************************************/
+bool QueueFile_IsFull(QueueFile_t *pObj);
+
+/*******************************************************************************
+ * @brief  Number of elements in the queue
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns Number of queued elements
+ ******************************************************************************/
+size_t QueueFile_Count(QueueFile_t *pObj);
+
+/*******************************************************************************
+ * @brief  Pushes some data type onto the queue
+ *
+ * @param pObj         Pointer to the queue object
+ * @param pDataInVoid  Pointer to the data that will be pushed onto the queue
+ *
+ * @returns Queue error flag. Queue_Error if full or a due flush failed.
+ ******************************************************************************/
+Queue_Error_e QueueFile_Push(QueueFile_t *pObj, void *pDataInVoid);
+
+/*******************************************************************************
+ * @brief  Pops some data type off the queue
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to the data that will be popped off the queue
+ *
+ * @returns Queue error flag. Queue_Error if empty or a due flush failed.
+ ******************************************************************************/
+Queue_Error_e QueueFile_Pop(QueueFile_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Peek at the data on the top of the queue
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to the peeked data
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueFile_Peek(QueueFile_t *pObj, void *pDataOutVoid);
+
+#endif /* QUEUE_FILE_H_INCLUDED */
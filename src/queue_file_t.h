@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * @file  queue_file_t.h
+ *
+ * @brief Durable file-backed queue type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef QUEUE_FILE_T_H_INCLUDED
+#define QUEUE_FILE_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "queue_t.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/**
+ * @brief File signature and layout version
+**/
+#define QUEUE_FILE_MAGIC       UINT32_C(0x51554546) /* "QUEF" */
+#define QUEUE_FILE_VERSION     UINT32_C(1)
+
+/**
+ * @brief Bytes reserved for the header at the start of the file
+**/
+#define QUEUE_FILE_HEADER_SIZE 64u
+
+/**
+ * @brief Bytes a slot for `dataSize` byte elements occupies in the file. Each
+ *        slot is a uint64_t sequence number, a uint32_t checksum, padding and
+ *        the element, rounded to 8 bytes.
+**/
+#define QUEUE_FILE_SLOT_SIZE(dataSize)                                         \
+    ((16u + (dataSize) + 7u) & ~(size_t)7u)
+
+/*============================================================================*
+ *                           E N U M E R A T I O N S                          *
+ *============================================================================*/
+
+/**
+ * @brief How committed operations are flushed to storage
+**/
+typedef enum _QueueFile_Sync_e
+{
+    QueueFile_Sync_None      = 0, /*!< Leave it to the kernel, or to QueueFile_Sync() */
+    QueueFile_Sync_Msync     = 1, /*!< msync(MS_SYNC) over the mapping */
+    QueueFile_Sync_Fdatasync = 2, /*!< fdatasync() on the file */
+} QueueFile_Sync_e;
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Sync policy
+**/
+typedef struct _QueueFile_Config_t
+{
+    QueueFile_Sync_e syncMode;  /*!< How to flush */
+    uint32_t         syncEvery; /*!< Flush after this many pushes and pops. 0 never flushes automatically. */
+} QueueFile_Config_t;
+
+/**
+ * @brief  On-disk header. Cursors are free-running element counts, so the
+ *         file never holds a pointer.
+**/
+typedef struct _QueueFile_Header_t
+{
+    uint32_t magic;    /*!< QUEUE_FILE_MAGIC */
+    uint32_t version;  /*!< QUEUE_FILE_VERSION */
+    uint64_t dataSize; /*!< Size of the data type stored in the queue */
+    uint64_t capacity; /*!< Number of slots */
+    uint32_t checksum; /*!< FNV-1a of the fields above */
+    uint32_t reserved; /*!< Zero */
+    uint64_t front;    /*!< Sequence number of the front element */
+    uint64_t rear;     /*!< Sequence number the next push will use */
+} QueueFile_Header_t;
+
+/**
+ * @brief  Durable file-backed queue object
+ *
+ * @details  The file is a QueueFile_Header_t followed by `capacity` slots.
+ *           Element `seq` lives in slot `seq % capacity`, stamped with `seq`
+ *           and a checksum over both, so recovery can tell a committed slot
+ *           from a stale or torn one.
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _QueueFile_t
+{
+    QueueFile_Header_t *pHdr;      /*!< Header, mapped from the file */
+    uint8_t            *pSlots;    /*!< First slot, mapped from the file */
+    size_t              mapSize;   /*!< Size of the mapping */
+    size_t              slotSize;  /*!< QUEUE_FILE_SLOT_SIZE(dataSize) */
+    size_t              capacity;  /*!< Number of slots */
+    size_t              dataSize;  /*!< Size of the data type to be stored in the queue */
+    int                 fd;        /*!< Backing file */
+    QueueFile_Config_t  config;    /*!< Sync policy */
+    uint32_t            unsynced;  /*!< Operations since the last flush */
+} QueueFile_t;
+
+#endif /* QUEUE_FILE_T_H_INCLUDED */
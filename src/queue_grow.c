@@ -0,0 +1,193 @@
+/*******************************************************************************
+ * @file  queue_grow.c
+ *
+ * @brief Growable queue implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <string.h>
+
+#include "queue.h"
+#include "queue_alloc.h"
+#include "queue_grow.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/* Double the buffer in place, then unwrap with a single copy */
+static Queue_Error_e QueueGrow_Grow(QueueGrow_t *pObj)
+{
+    Queue_t *pQueue = &pObj->queue;
+    size_t oldSize = pQueue->bufSize;
+
+    if (oldSize > (SIZE_MAX - 1) / 2)
+    {
+        return Queue_Error;
+    }
+
+    size_t newSize = 2 * oldSize;
+    uint8_t *pBuf = pObj->allocator.pfnRealloc(pObj->allocator.pCtx, pQueue->pBuf, oldSize, newSize);
+    if (pBuf == NULL)
+    {
+        return Queue_Error;
+    }
+    pQueue->pBuf = pBuf;
+    pQueue->bufSize = newSize;
+
+    /* Only ever called when full, so front == rear. Data runs [front, oldSize)
+     * then [0, rear). Move whichever half is shorter into the new space. */
+    if (pQueue->rear == 0)
+    {
+        pQueue->rear = oldSize;
+    }
+    else if (pQueue->rear <= oldSize - pQueue->front)
+    {
+        memcpy(&pBuf[oldSize], pBuf, pQueue->rear);
+        pQueue->rear += oldSize;
+    }
+    else
+    {
+        size_t front = pQueue->front + (newSize - oldSize);
+        memcpy(&pBuf[front], &pBuf[pQueue->front], oldSize - pQueue->front);
+        pQueue->front = front;
+    }
+
+    return Queue_Error_None;
+}
+
+/* Halve the buffer, unwrapping the contents into the new one in one pass */
+static void QueueGrow_Shrink(QueueGrow_t *pObj)
+{
+    Queue_t *pQueue = &pObj->queue;
+    size_t newSize = (pQueue->bufSize / pQueue->dataSize / 2) * pQueue->dataSize;
+
+    if (newSize < pObj->minBufSize)
+    {
+        newSize = pObj->minBufSize;
+    }
+
+    uint8_t *pBuf = pObj->allocator.pfnAlloc(pObj->allocator.pCtx, newSize);
+    if (pBuf == NULL)
+    {
+        /* Keep the larger buffer, shrinking is only an optimization */
+        return;
+    }
+
+    /* Copy the two runs across directly rather than popping, so the queue's
+     * own push/pop accounting is not disturbed */
+    size_t count = Queue_Count(pQueue);
+    size_t first;
+    void *pFront = Queue_PeekRef(pQueue, &first);
+    size_t bytes = count * pQueue->dataSize;
+    if (count > 0)
+    {
+        memcpy(pBuf, pFront, first * pQueue->dataSize);
+        memcpy(&pBuf[first * pQueue->dataSize], pQueue->pBuf, (count - first) * pQueue->dataSize);
+    }
+
+    pObj->allocator.pfnFree(pObj->allocator.pCtx, pQueue->pBuf, pQueue->bufSize);
+    pQueue->pBuf = pBuf;
+    pQueue->bufSize = newSize;
+    pQueue->front = (count > 0) ? 0 : SIZE_MAX;
+    pQueue->rear = (bytes == newSize) ? 0 : bytes;
+}
+
+/* Track how long occupancy has stayed low, and shrink once it has for long enough */
+static void QueueGrow_Observe(QueueGrow_t *pObj)
+{
+    Queue_t *pQueue = &pObj->queue;
+    size_t capacity = pQueue->bufSize / pQueue->dataSize;
+
+    if (pQueue->bufSize <= pObj->minBufSize || Queue_Count(pQueue) > capacity / 4)
+    {
+        pObj->lowOps = 0;
+        return;
+    }
+
+    /* Waiting capacity / 8 operations keeps the copy cost amortized O(1) */
+    if (++pObj->lowOps >= capacity / 8)
+    {
+        pObj->lowOps = 0;
+        QueueGrow_Shrink(pObj);
+    }
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Queue_Error_e QueueGrow_Init(QueueGrow_t *pObj, const Queue_Allocator_t *pAllocator,
+                             size_t initialElems, size_t dataSize)
+{
+    if (dataSize == 0 || initialElems == 0 || initialElems > (SIZE_MAX - 1) / dataSize)
+    {
+        return Queue_Error;
+    }
+
+    pObj->allocator = (pAllocator != NULL) ? *pAllocator : Queue_Allocator_Default;
+
+    size_t bufSize = initialElems * dataSize;
+    void *pBuf = pObj->allocator.pfnAlloc(pObj->allocator.pCtx, bufSize);
+    if (pBuf == NULL)
+    {
+        return Queue_Error;
+    }
+    pObj->minBufSize = bufSize;
+    pObj->lowOps = 0;
+
+    return Queue_Init(&pObj->queue, pBuf, bufSize, dataSize);
+}
+
+void QueueGrow_Deinit(QueueGrow_t *pObj)
+{
+    pObj->allocator.pfnFree(pObj->allocator.pCtx, pObj->queue.pBuf, pObj->queue.bufSize);
+    pObj->queue.pBuf = NULL;
+}
+
+bool QueueGrow_IsEmpty(QueueGrow_t *pObj)
+{
+    return Queue_IsEmpty(&pObj->queue);
+}
+
+size_t QueueGrow_Count(QueueGrow_t *pObj)
+{
+    return Queue_Count(&pObj->queue);
+}
+
+size_t QueueGrow_Capacity(QueueGrow_t *pObj)
+{
+    return pObj->queue.bufSize / pObj->queue.dataSize;
+}
+
+Queue_Error_e QueueGrow_Push(QueueGrow_t *pObj, void *pDataInVoid)
+{
+    if (Queue_IsFull(&pObj->queue) && QueueGrow_Grow(pObj) != Queue_Error_None)
+    {
+        return Queue_Error;
+    }
+    Queue_Error_e err = Queue_Push(&pObj->queue, pDataInVoid);
+    QueueGrow_Observe(pObj);
+
+    return err;
+}
+
+Queue_Error_e QueueGrow_Pop(QueueGrow_t *pObj, void *pDataOutVoid)
+{
+    if (Queue_Pop(&pObj->queue, pDataOutVoid) != Queue_Error_None)
+    {
+        return Queue_Error;
+    }
+    QueueGrow_Observe(pObj);
+
+    return Queue_Error_None;
+}
+
+Queue_Error_e QueueGrow_Peek(QueueGrow_t *pObj, void *pDataOutVoid)
+{
+    return Queue_Peek(&pObj->queue, pDataOutVoid);
+}
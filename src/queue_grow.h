@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * @file  queue_grow.h
+ *
+ * @brief Growable queue public function declarations
+ *
+ * @details  Queue that owns its buffer through pluggable allocator callbacks.
+ *           A push onto a full queue doubles the buffer instead of failing.
+ *           Once occupancy has stayed at or below a quarter of the capacity
+ *           for a while, the buffer is halved again, down to its initial size.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef QUEUE_GROW_H_INCLUDED
+#define QUEUE_GROW_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "queue_grow_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Initializes the growable queue object and allocates its buffer
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pAllocator    Allocator callbacks, copied into the object. NULL uses
+ *                      malloc(), realloc() and free().
+ * @param initialElems  Initial and minimum capacity in elements
+ * @param dataSize      Size of the data type that the queue is handling
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueGrow_Init(QueueGrow_t *pObj, const Queue_Allocator_t *pAllocator,
+                             size_t initialElems, size_t dataSize);
+
+/*******************************************************************************
+ * @brief  Releases the queue buffer. Queued data is discarded.
+ *
+ * @param pObj  Pointer to the queue object
+ ******************************************************************************/
+void QueueGrow_Deinit(QueueGrow_t *pObj);
+
+/*******************************************************************************
+ * @brief  Check if the queue is empty
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns true if empty
+ ******************************************************************************/
+bool QueueGrow_IsEmpty(QueueGrow_t *pObj);
+
+/*******************************************************************************
+ * @brief  Number of elements in the queue
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns Element count
+ ******************************************************************************/
+size_t QueueGrow_Count(QueueGrow_t *pObj);
+
+/*******************************************************************************
+ * @brief  Current capacity of the queue
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns Capacity in elements
+ ******************************************************************************/
+size_t QueueGrow_Capacity(QueueGrow_t *pObj);
+
+/*******************************************************************************
+ * @brief  Pushes some data type onto the queue, growing it if full
+ *
+ * @param pObj         Pointer to the queue object
+ * @param pDataInVoid  Pointer to the data that will be pushed onto the queue
+ *
+ * @returns Queue error flag. Queue_Error only if the buffer could not grow.
+ ******************************************************************************/
+Queue_Error_e QueueGrow_Push(QueueGrow_t *pObj, void *pDataInVoid);
+
+/*******************************************************************************
+ * @brief  Pops some data type off the queue, shrinking it if it stays sparse
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to the data that will be popped off the queue
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueGrow_Pop(QueueGrow_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Peek at the data on the top of the queue
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to the peeked data
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueGrow_Peek(QueueGrow_t *pObj, void *pDataOutVoid);
+
+#endif /* QUEUE_GROW_H_INCLUDED */
@@ -0,0 +1,38 @@
+/*******************************************************************************
+ * @file  queue_grow_t.h
+ *
+ * @brief Growable queue type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef QUEUE_GROW_T_H_INCLUDED
+#define QUEUE_GROW_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "queue_t.h"
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Growable queue object
+ *
+ * @details  Wraps a Queue_t whose buffer is owned through the allocator.
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _QueueGrow_t
+{
+    Queue_t           queue;      /*!< Underlying queue */
+    Queue_Allocator_t allocator;  /*!< Allocator that owns queue.pBuf */
+    size_t            minBufSize; /*!< Buffer size never shrunk below */
+    size_t            lowOps;     /*!< Consecutive operations that left the queue at most a quarter full */
+} QueueGrow_t;
+
+#endif /* QUEUE_GROW_T_H_INCLUDED */
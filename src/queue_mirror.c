@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * @file  queue_mirror.c
+ *
+ * @brief Mirrored queue buffer implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "queue.h"
+#include "queue_mirror.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+static size_t Queue_Mirror_Gcd(size_t a, size_t b)
+{
+    while (b != 0)
+    {
+        size_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+/* Map the same pages of fd at pAddr and pAddr + size */
+static uint8_t *Queue_Mirror_Map(int fd, size_t size)
+{
+    /* Reserve both halves at once so nothing else can land in between */
+    uint8_t *pAddr = mmap(NULL, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (pAddr == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    if (mmap(pAddr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+        mmap(pAddr + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+    {
+        munmap(pAddr, 2 * size);
+        return NULL;
+    }
+
+    return pAddr;
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Queue_Error_e Queue_InitMirrored(Queue_t *pObj, size_t bufSize, size_t dataSize)
+{
+    long pageSize = sysconf(_SC_PAGESIZE);
+
+    if (dataSize == 0 || bufSize == 0 || pageSize <= 0)
+    {
+        return Queue_Error;
+    }
+
+    /* Round up to a common multiple of the page and data sizes */
+    size_t unit = (size_t)pageSize / Queue_Mirror_Gcd((size_t)pageSize, dataSize);
+    if (unit > SIZE_MAX / dataSize)
+    {
+        return Queue_Error;
+    }
+    unit *= dataSize;
+    if (bufSize > SIZE_MAX / 4 - unit)
+    {
+        return Queue_Error;
+    }
+    bufSize = (bufSize + unit - 1) / unit * unit;
+
+    int fd = memfd_create("queue_mirror", MFD_CLOEXEC);
+    if (fd == -1)
+    {
+        return Queue_Error;
+    }
+
+    /* The mappings keep the pages alive, the descriptor is not needed after */
+    uint8_t *pBuf = NULL;
+    if (ftruncate(fd, (off_t)bufSize) == 0)
+    {
+        pBuf = Queue_Mirror_Map(fd, bufSize);
+    }
+    close(fd);
+
+    if (pBuf == NULL)
+    {
+        return Queue_Error;
+    }
+
+    Queue_Init(pObj, pBuf, bufSize, dataSize);
+    pObj->mirrored = true;
+
+    return Queue_Error_None;
+}
+
+void Queue_DeinitMirrored(Queue_t *pObj)
+{
+    munmap(pObj->pBuf, 2 * pObj->bufSize);
+    pObj->pBuf = NULL;
+}
@@ -0,0 +1,50 @@
+/*******************************************************************************
+ * @file  queue_mirror.h
+ *
+ * @brief Mirrored queue buffer public function declarations
+ *
+ * @details  Sets up a Queue_t over a buffer that is mapped twice, back to
+ *           back, so that pBuf[bufSize, 2 * bufSize) aliases pBuf[0, bufSize).
+ *           Every run of queued or free elements is then contiguous in virtual
+ *           memory: Queue_PushN() and Queue_PopN() make a single copy, and
+ *           Queue_ReserveWrite() and Queue_PeekRef() return the whole run even
+ *           across the wrap point. The queue is otherwise used through the
+ *           normal Queue_* functions. Linux only (memfd_create).
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef QUEUE_MIRROR_H_INCLUDED
+#define QUEUE_MIRROR_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+
+#include "queue_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Maps a mirrored buffer and initializes the queue object over it
+ *
+ * @param pObj      Pointer to the queue object
+ * @param bufSize   Minimum queue buffer size. Rounded up to the smallest whole
+ *                  number of pages that is also a multiple of dataSize.
+ * @param dataSize  Size of the data type that the queue is handling
+ *
+ * @returns Queue error flag. Queue_Error if the mapping could not be made.
+ ******************************************************************************/
+Queue_Error_e Queue_InitMirrored(Queue_t *pObj, size_t bufSize, size_t dataSize);
+
+/*******************************************************************************
+ * @brief  Unmaps the buffer of a queue set up with Queue_InitMirrored()
+ *
+ * @param pObj  Pointer to the queue object
+ ******************************************************************************/
+void Queue_DeinitMirrored(Queue_t *pObj);
+
+#endif /* QUEUE_MIRROR_H_INCLUDED */
@@ -0,0 +1,197 @@
+/*******************************************************************************
+ * @file  queue_mpmc.c
+ *
+ * @brief Multi-producer/multi-consumer queue implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include "queue_mpmc.h"
+#include "queue_copy.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/* Sequence counter of the cell that a position maps onto */
+static inline atomic_size_t *QueueMpmc_Seq(QueueMpmc_t *pObj, size_t pos)
+{
+    return (atomic_size_t *)&pObj->pBuf[(pos & pObj->mask) * pObj->cellSize];
+}
+
+/* Data of the cell that a position maps onto */
+static inline uint8_t *QueueMpmc_Data(QueueMpmc_t *pObj, size_t pos)
+{
+    return (uint8_t *)(QueueMpmc_Seq(pObj, pos) + 1);
+}
+
+/* Signed distance between a cell sequence and the position being claimed */
+static inline intptr_t QueueMpmc_Diff(size_t seq, size_t pos)
+{
+    return (intptr_t)(seq - pos);
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Queue_Error_e QueueMpmc_Init(QueueMpmc_t *pObj, void *pBuf, size_t bufSize, size_t dataSize)
+{
+    if (dataSize == 0 || (uintptr_t)pBuf % _Alignof(atomic_size_t) != 0)
+    {
+        return Queue_Error;
+    }
+
+    size_t cellSize = QUEUE_MPMC_CELL_SIZE(dataSize);
+    size_t cells = bufSize / cellSize;
+    if (bufSize % cellSize != 0 || cells < 2 || (cells & (cells - 1)) != 0)
+    {
+        return Queue_Error;
+    }
+
+    pObj->pBuf = pBuf;
+    pObj->mask = cells - 1;
+    pObj->cellSize = cellSize;
+    pObj->dataSize = dataSize;
+    pObj->pfnCopy = Queue_Copy_Select(dataSize);
+
+    /* Cell n is free for the producer that claims position n */
+    for (size_t cell = 0; cell < cells; cell++)
+    {
+        atomic_init(QueueMpmc_Seq(pObj, cell), cell);
+    }
+    atomic_init(&pObj->tail, 0);
+    atomic_init(&pObj->head, 0);
+
+    return Queue_Error_None;
+}
+
+bool QueueMpmc_IsEmpty(QueueMpmc_t *pObj)
+{
+    size_t head = atomic_load_explicit(&pObj->head, memory_order_acquire);
+    size_t seq = atomic_load_explicit(QueueMpmc_Seq(pObj, head), memory_order_acquire);
+
+    return (QueueMpmc_Diff(seq, head + 1) < 0);
+}
+
+bool QueueMpmc_IsFull(QueueMpmc_t *pObj)
+{
+    size_t tail = atomic_load_explicit(&pObj->tail, memory_order_acquire);
+    size_t seq = atomic_load_explicit(QueueMpmc_Seq(pObj, tail), memory_order_acquire);
+
+    return (QueueMpmc_Diff(seq, tail) < 0);
+}
+
+Queue_Error_e QueueMpmc_Push(QueueMpmc_t *pObj, void *pDataInVoid)
+{
+    size_t pos = atomic_load_explicit(&pObj->tail, memory_order_relaxed);
+
+    /* Claim a free cell */
+    for (;;)
+    {
+        size_t seq = atomic_load_explicit(QueueMpmc_Seq(pObj, pos), memory_order_acquire);
+        intptr_t diff = QueueMpmc_Diff(seq, pos);
+
+        if (diff == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&pObj->tail, &pos, pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            /* The consumer of the previous lap has not released it yet */
+            return Queue_Error;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&pObj->tail, memory_order_relaxed);
+        }
+    }
+
+    /* Push the data into the queue */
+    uint8_t *pDst = QueueMpmc_Data(pObj, pos);
+    pObj->pfnCopy(pDst, pDataInVoid, pObj->dataSize);
+
+    /* Hand the cell to the consumer of this lap */
+    atomic_store_explicit(QueueMpmc_Seq(pObj, pos), pos + 1, memory_order_release);
+
+    return Queue_Error_None;
+}
+
+Queue_Error_e QueueMpmc_Pop(QueueMpmc_t *pObj, void *pDataOutVoid)
+{
+    size_t pos = atomic_load_explicit(&pObj->head, memory_order_relaxed);
+
+    /* Claim a filled cell */
+    for (;;)
+    {
+        size_t seq = atomic_load_explicit(QueueMpmc_Seq(pObj, pos), memory_order_acquire);
+        intptr_t diff = QueueMpmc_Diff(seq, pos + 1);
+
+        if (diff == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&pObj->head, &pos, pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            /* The producer of this lap has not published it yet */
+            return Queue_Error;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&pObj->head, memory_order_relaxed);
+        }
+    }
+
+    /* Pop the data off the queue */
+    uint8_t *pSrc = QueueMpmc_Data(pObj, pos);
+    pObj->pfnCopy(pDataOutVoid, pSrc, pObj->dataSize);
+
+    /* Hand the cell to the producer of the next lap */
+    atomic_store_explicit(QueueMpmc_Seq(pObj, pos), pos + pObj->mask + 1, memory_order_release);
+
+    return Queue_Error_None;
+}
+
+Queue_Error_e QueueMpmc_Peek(QueueMpmc_t *pObj, void *pDataOutVoid)
+{
+    for (;;)
+    {
+        size_t pos = atomic_load_explicit(&pObj->head, memory_order_acquire);
+        atomic_size_t *pSeq = QueueMpmc_Seq(pObj, pos);
+        size_t seq = atomic_load_explicit(pSeq, memory_order_acquire);
+        intptr_t diff = QueueMpmc_Diff(seq, pos + 1);
+
+        if (diff < 0)
+        {
+            return Queue_Error;
+        }
+        if (diff > 0)
+        {
+            continue;
+        }
+
+        /* Copy the data out without updating object state */
+        uint8_t *pSrc = QueueMpmc_Data(pObj, pos);
+        pObj->pfnCopy(pDataOutVoid, pSrc, pObj->dataSize);
+
+        /* The copy is only valid if the cell was not recycled meanwhile */
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(pSeq, memory_order_relaxed) == seq)
+        {
+            return Queue_Error_None;
+        }
+    }
+}
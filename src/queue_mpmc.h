@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * @file  queue_mpmc.h
+ *
+ * @brief Multi-producer/multi-consumer queue public function declarations
+ *
+ * @details  Bounded lock-free queue that any number of producer and consumer
+ *           threads may share. Each buffer cell holds a sequence counter next
+ *           to the data, so the buffer must be sized with
+ *           QUEUE_MPMC_BUF_SIZE() rather than a plain array of the data type.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef QUEUE_MPMC_H_INCLUDED
+#define QUEUE_MPMC_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "queue_mpmc_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Initializes the MPMC queue object
+ *
+ * @details  The caller is responsible for allocating the queue object, and
+ *           queue buffer. Initialization must complete before any thread
+ *           starts using the queue.
+ *
+ * @param pObj      Pointer to the queue object
+ * @param pBuf      Pointer to the queue buffer. Must be aligned for size_t
+ * @param bufSize   Queue buffer size. Must be QUEUE_MPMC_BUF_SIZE(n, dataSize)
+ *                  where n is a power of two no smaller than 2
+ * @param dataSize  Size of the data type that the queue is handling
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueMpmc_Init(QueueMpmc_t *pObj, void *pBuf, size_t bufSize, size_t dataSize);
+
+/*******************************************************************************
+ * @brief  Check if the queue is empty
+ *
+ * @note   The result is a snapshot and may be stale once other threads run.
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns true if empty
+ ******************************************************************************/
+bool QueueMpmc_IsEmpty(QueueMpmc_t *pObj);
+
+/*******************************************************************************
+ * @brief Check if the queue is full
+ *
+ * @note   The result is a snapshot and may be stale once other threads run.
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns true if full
+ ******************************************************************************/
+bool QueueMpmc_IsFull(QueueMpmc_t *pObj);
+
+/*******************************************************************************
+ * @brief  Pushes some data type onto the queue
+ *
+ * @param pObj         Pointer to the queue object
+ * @param pDataInVoid  Pointer to the data that will be pushed onto the queue
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueMpmc_Push(QueueMpmc_t *pObj, void *pDataInVoid);
+
+/*******************************************************************************
+ * @brief  Pops some data type off the queue
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to the data that will be popped off the queue
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueMpmc_Pop(QueueMpmc_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Peek at the data on the top of the queue
+ *
+ * @note   With several consumers the peeked element may already have been
+ *         popped by another thread by the time the call returns.
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to the peeked data
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueMpmc_Peek(QueueMpmc_t *pObj, void *pDataOutVoid);
+
+#endif /* QUEUE_MPMC_H_INCLUDED */
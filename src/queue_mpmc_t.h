@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * @file  queue_mpmc_t.h
+ *
+ * @brief Multi-producer/multi-consumer queue type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef QUEUE_MPMC_T_H_INCLUDED
+#define QUEUE_MPMC_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+#include "queue_t.h"
+#include "queue_spsc_t.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/**
+ * @brief Size of one buffer cell: a sequence counter followed by the data,
+ *        padded so the next counter stays aligned
+**/
+#define QUEUE_MPMC_CELL_SIZE(dataSize)                                         \
+    ((sizeof(atomic_size_t) + (dataSize) + _Alignof(atomic_size_t) - 1) &     \
+     ~(_Alignof(atomic_size_t) - 1))
+
+/**
+ * @brief Buffer size required to hold `elements` items of `dataSize` bytes
+**/
+#define QUEUE_MPMC_BUF_SIZE(elements, dataSize)                                \
+    ((elements) * QUEUE_MPMC_CELL_SIZE(dataSize))
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Multi-producer/multi-consumer queue object
+ *
+ * @details  Every cell carries a sequence counter that tells producers and
+ *           consumers whose turn it is. Producers claim a cell with a CAS on
+ *           `tail`, consumers with a CAS on `head`, so no global lock is held.
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _QueueMpmc_t
+{
+    /* Producer contended */
+    _Alignas(QUEUE_CACHE_LINE_SIZE)
+    atomic_size_t tail;      /*!< Next cell to be claimed by a producer */
+
+    /* Consumer contended */
+    _Alignas(QUEUE_CACHE_LINE_SIZE)
+    atomic_size_t head;      /*!< Next cell to be claimed by a consumer */
+
+    /* Read-only after init */
+    _Alignas(QUEUE_CACHE_LINE_SIZE)
+    uint8_t      *pBuf;      /*!< Pointer to the queue buffer */
+    size_t        mask;      /*!< Number of cells minus one */
+    size_t        cellSize;  /*!< Size of one cell in the buffer */
+    size_t        dataSize;  /*!< Size of the data type to be stored in the queue */
+    Queue_Copy_f  pfnCopy;   /*!< Element copy routine selected for dataSize */
+} QueueMpmc_t;
+
+#endif /* QUEUE_MPMC_T_H_INCLUDED */
@@ -0,0 +1,180 @@
+/*******************************************************************************
+ * @file  queue_mpsc.c
+ *
+ * @brief Multi-producer/single-consumer queue implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <sched.h>
+
+#include "queue_mpsc.h"
+#include "queue_copy.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/* Sequence counter of the cell that a position maps onto */
+static inline atomic_size_t *QueueMpsc_Seq(QueueMpsc_t *pObj, size_t pos)
+{
+    return (atomic_size_t *)&pObj->pBuf[(pos & pObj->mask) * pObj->cellSize];
+}
+
+/* Data of the cell that a position maps onto */
+static inline uint8_t *QueueMpsc_Data(QueueMpsc_t *pObj, size_t pos)
+{
+    return (uint8_t *)(QueueMpsc_Seq(pObj, pos) + 1);
+}
+
+/* Hint to the CPU that we are busy waiting */
+static inline void QueueMpsc_CpuRelax(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
+
+/* Check whether the producer of a position has committed its cell */
+static inline bool QueueMpsc_IsCommitted(QueueMpsc_t *pObj, size_t pos)
+{
+    return (atomic_load_explicit(QueueMpsc_Seq(pObj, pos), memory_order_acquire) == pos + 1);
+}
+
+/* Copy one cell out and hand it to the producer of the next lap */
+static inline void QueueMpsc_Take(QueueMpsc_t *pObj, size_t pos, uint8_t *pDataOut)
+{
+    uint8_t *pSrc = QueueMpsc_Data(pObj, pos);
+    pObj->pfnCopy(pDataOut, pSrc, pObj->dataSize);
+    atomic_store_explicit(QueueMpsc_Seq(pObj, pos), pos + pObj->mask + 1, memory_order_release);
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Queue_Error_e QueueMpsc_Init(QueueMpsc_t *pObj, void *pBuf, size_t bufSize, size_t dataSize)
+{
+    if (dataSize == 0 || (uintptr_t)pBuf % _Alignof(atomic_size_t) != 0)
+    {
+        return Queue_Error;
+    }
+
+    size_t cellSize = QUEUE_MPMC_CELL_SIZE(dataSize);
+    size_t cells = bufSize / cellSize;
+    if (bufSize % cellSize != 0 || cells < 2 || (cells & (cells - 1)) != 0)
+    {
+        return Queue_Error;
+    }
+
+    pObj->pBuf = pBuf;
+    pObj->mask = cells - 1;
+    pObj->cellSize = cellSize;
+    pObj->dataSize = dataSize;
+    pObj->pfnCopy = Queue_Copy_Select(dataSize);
+
+    /* Cell n is free for the producer that claims position n */
+    for (size_t cell = 0; cell < cells; cell++)
+    {
+        atomic_init(QueueMpsc_Seq(pObj, cell), cell);
+    }
+    atomic_init(&pObj->tail, 0);
+    atomic_init(&pObj->head, 0);
+
+    return Queue_Error_None;
+}
+
+bool QueueMpsc_IsEmpty(QueueMpsc_t *pObj)
+{
+    size_t head = atomic_load_explicit(&pObj->head, memory_order_relaxed);
+
+    return !QueueMpsc_IsCommitted(pObj, head);
+}
+
+bool QueueMpsc_IsFull(QueueMpsc_t *pObj)
+{
+    size_t tail = atomic_load_explicit(&pObj->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&pObj->head, memory_order_acquire);
+
+    return (tail - head > pObj->mask);
+}
+
+Queue_Error_e QueueMpsc_Push(QueueMpsc_t *pObj, void *pDataInVoid)
+{
+    if (QueueMpsc_IsFull(pObj))
+    {
+        return Queue_Error;
+    }
+
+    /* Claim a cell */
+    size_t pos = atomic_fetch_add_explicit(&pObj->tail, 1, memory_order_relaxed);
+
+    /* Only producers that raced past the full check can find it still held */
+    atomic_size_t *pSeq = QueueMpsc_Seq(pObj, pos);
+    for (uint32_t spin = 1; atomic_load_explicit(pSeq, memory_order_acquire) != pos; spin++)
+    {
+        /* Wait for the consumer to release the previous lap, and give up the
+         * CPU now and then in case the consumer needs it to get there */
+        QueueMpsc_CpuRelax();
+        if (spin % QUEUE_MPSC_YIELD_SPINS == 0)
+        {
+            sched_yield();
+        }
+    }
+
+    /* Push the data into the queue */
+    uint8_t *pDst = QueueMpsc_Data(pObj, pos);
+    pObj->pfnCopy(pDst, pDataInVoid, pObj->dataSize);
+
+    /* Commit the cell to the consumer */
+    atomic_store_explicit(pSeq, pos + 1, memory_order_release);
+
+    return Queue_Error_None;
+}
+
+Queue_Error_e QueueMpsc_Pop(QueueMpsc_t *pObj, void *pDataOutVoid)
+{
+    return (QueueMpsc_PopAll(pObj, pDataOutVoid, 1) == 1) ? Queue_Error_None : Queue_Error;
+}
+
+size_t QueueMpsc_PopAll(QueueMpsc_t *pObj, void *pDataOutVoid, size_t maxElems)
+{
+    size_t head = atomic_load_explicit(&pObj->head, memory_order_relaxed);
+    uint8_t *pDataOut = pDataOutVoid;
+    size_t popped = 0;
+
+    while (popped < maxElems && QueueMpsc_IsCommitted(pObj, head))
+    {
+        QueueMpsc_Take(pObj, head, pDataOut);
+        pDataOut += pObj->dataSize;
+        head++;
+        popped++;
+    }
+
+    /* Publish the new head once for the whole batch */
+    if (popped > 0)
+    {
+        atomic_store_explicit(&pObj->head, head, memory_order_release);
+    }
+
+    return popped;
+}
+
+Queue_Error_e QueueMpsc_Peek(QueueMpsc_t *pObj, void *pDataOutVoid)
+{
+    size_t head = atomic_load_explicit(&pObj->head, memory_order_relaxed);
+
+    if (!QueueMpsc_IsCommitted(pObj, head))
+    {
+        return Queue_Error;
+    }
+
+    /* Copy the data out without updating object state */
+    uint8_t *pSrc = QueueMpsc_Data(pObj, head);
+    pObj->pfnCopy(pDataOutVoid, pSrc, pObj->dataSize);
+
+    return Queue_Error_None;
+}
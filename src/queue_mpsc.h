@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * @file  queue_mpsc.h
+ *
+ * @brief Multi-producer/single-consumer queue public function declarations
+ *
+ * @details  Bounded queue that any number of producer threads may push into
+ *           while exactly one consumer thread pops. Cheaper than the MPMC
+ *           queue: a push costs one fetch-and-add, a pop costs no atomic
+ *           read-modify-write at all. The price is that a push racing a
+ *           full queue waits for the consumer, see QueueMpsc_Push(). Buffers
+ *           are sized with QUEUE_MPSC_BUF_SIZE().
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef QUEUE_MPSC_H_INCLUDED
+#define QUEUE_MPSC_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "queue_mpsc_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Initializes the MPSC queue object
+ *
+ * @details  The caller is responsible for allocating the queue object, and
+ *           queue buffer. Initialization must complete before any thread
+ *           starts using the queue.
+ *
+ * @param pObj      Pointer to the queue object
+ * @param pBuf      Pointer to the queue buffer. Must be aligned for size_t
+ * @param bufSize   Queue buffer size. Must be QUEUE_MPSC_BUF_SIZE(n, dataSize)
+ *                  where n is a power of two no smaller than 2
+ * @param dataSize  Size of the data type that the queue is handling
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueMpsc_Init(QueueMpsc_t *pObj, void *pBuf, size_t bufSize, size_t dataSize);
+
+/*******************************************************************************
+ * @brief  Check if the queue has no committed element at its front
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns true if empty
+ ******************************************************************************/
+bool QueueMpsc_IsEmpty(QueueMpsc_t *pObj);
+
+/*******************************************************************************
+ * @brief Check if every cell has been claimed by a producer
+ *
+ * @note   The result is a snapshot and may be stale once other threads run.
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns true if full
+ ******************************************************************************/
+bool QueueMpsc_IsFull(QueueMpsc_t *pObj);
+
+/*******************************************************************************
+ * @brief  Pushes some data type onto the queue. Any thread.
+ *
+ * @details  Fails without claiming a cell if the queue looks full. When
+ *           several producers race for the last free cells, a producer that
+ *           overshoots has already claimed a cell with its fetch-and-add and
+ *           cannot give it back, so it waits for the consumer to release that
+ *           cell instead of failing.
+ *
+ * @warning  Once a cell is claimed there is no timeout. A push that races a
+ *           full queue blocks indefinitely, until the consumer pops the
+ *           element in that cell. If the consumer stalls or exits, every
+ *           producer caught this way busy waits on its own CPU, pausing and
+ *           yielding every QUEUE_MPSC_YIELD_SPINS spins. Use QueueMpmc_t
+ *           when producers must never wait on the consumer.
+ *
+ * @param pObj         Pointer to the queue object
+ * @param pDataInVoid  Pointer to the data that will be pushed onto the queue
+ *
+ * @returns Queue error flag. Queue_Error only if the queue looked full before
+ *          a cell was claimed.
+ ******************************************************************************/
+Queue_Error_e QueueMpsc_Push(QueueMpsc_t *pObj, void *pDataInVoid);
+
+/*******************************************************************************
+ * @brief  Pops some data type off the queue. Consumer only.
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to the data that will be popped off the queue
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueMpsc_Pop(QueueMpsc_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Pops every committed element off the queue at once. Consumer only.
+ *
+ * @details  Stops at the first cell that has been claimed but not yet
+ *           committed by its producer, so elements are always returned in
+ *           order. The head cursor is published once for the whole batch.
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to an array of at least maxElems data types
+ * @param maxElems      Maximum number of elements to pop
+ *
+ * @returns Number of elements popped
+ ******************************************************************************/
+size_t QueueMpsc_PopAll(QueueMpsc_t *pObj, void *pDataOutVoid, size_t maxElems);
+
+/*******************************************************************************
+ * @brief  Peek at the data on the top of the queue. Consumer only.
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to the peeked data
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueMpsc_Peek(QueueMpsc_t *pObj, void *pDataOutVoid);
+
+#endif /* QUEUE_MPSC_H_INCLUDED */
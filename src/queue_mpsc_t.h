@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * @file  queue_mpsc_t.h
+ *
+ * @brief Multi-producer/single-consumer queue type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef QUEUE_MPSC_T_H_INCLUDED
+#define QUEUE_MPSC_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+#include "queue_t.h"
+#include "queue_mpmc_t.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/**
+ * @brief Buffer size required to hold `elements` items of `dataSize` bytes.
+ *        Cells share the MPMC layout of a sequence counter plus data.
+**/
+#define QUEUE_MPSC_BUF_SIZE(elements, dataSize)                                \
+    QUEUE_MPMC_BUF_SIZE(elements, dataSize)
+
+/**
+ * @brief Spins on a held cell between yields of the producer's time slice
+**/
+#ifndef QUEUE_MPSC_YIELD_SPINS
+#define QUEUE_MPSC_YIELD_SPINS 64
+#endif
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Multi-producer/single-consumer queue object
+ *
+ * @details  Producers claim a cell with a single fetch-and-add on `tail` and
+ *           commit it through the cell's sequence counter. The consumer owns
+ *           `head` and only ever loads and stores, never read-modify-writes.
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _QueueMpsc_t
+{
+    /* Producer contended */
+    _Alignas(QUEUE_CACHE_LINE_SIZE)
+    atomic_size_t tail;      /*!< Next cell to be claimed by a producer */
+
+    /* Consumer owned */
+    _Alignas(QUEUE_CACHE_LINE_SIZE)
+    atomic_size_t head;      /*!< Next cell to be read, published by the consumer */
+
+    /* Read-only after init */
+    _Alignas(QUEUE_CACHE_LINE_SIZE)
+    uint8_t      *pBuf;      /*!< Pointer to the queue buffer */
+    size_t        mask;      /*!< Number of cells minus one */
+    size_t        cellSize;  /*!< Size of one cell in the buffer */
+    size_t        dataSize;  /*!< Size of the data type to be stored in the queue */
+    Queue_Copy_f  pfnCopy;   /*!< Element copy routine selected for dataSize */
+} QueueMpsc_t;
+
+#endif /* QUEUE_MPSC_T_H_INCLUDED */
@@ -0,0 +1,176 @@
+/*******************************************************************************
+ * @file  queue_msg.c
+ *
+ * @brief Variable-length message queue implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <string.h>
+
+#include "queue_msg.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/* Header value marking the unused tail of the buffer before a wrap */
+#define QUEUE_MSG_SKIP    UINT32_MAX
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/* Length header of the record at an offset */
+static inline uint32_t *QueueMsg_Header(QueueMsg_t *pObj, size_t offset)
+{
+    return (uint32_t *)&pObj->pBuf[offset];
+}
+
+/* Offset of the front record, following a skip marker if there is one */
+static inline size_t QueueMsg_FrontRecord(QueueMsg_t *pObj)
+{
+    return (*QueueMsg_Header(pObj, pObj->front) == QUEUE_MSG_SKIP) ? 0 : pObj->front;
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Queue_Error_e QueueMsg_Init(QueueMsg_t *pObj, void *pBuf, size_t bufSize)
+{
+    if (bufSize == 0 || bufSize % QUEUE_MSG_ALIGN != 0 || (uintptr_t)pBuf % QUEUE_MSG_ALIGN != 0)
+    {
+        return Queue_Error;
+    }
+    pObj->front = 0;
+    pObj->rear = 0;
+    pObj->used = 0;
+    pObj->count = 0;
+    pObj->pBuf = pBuf;
+    pObj->bufSize = bufSize;
+
+    return Queue_Error_None;
+}
+
+bool QueueMsg_IsEmpty(QueueMsg_t *pObj)
+{
+    return (pObj->count == 0);
+}
+
+size_t QueueMsg_Count(QueueMsg_t *pObj)
+{
+    return pObj->count;
+}
+
+Queue_Error_e QueueMsg_PushBytes(QueueMsg_t *pObj, void *pDataInVoid, size_t len)
+{
+    if (len >= QUEUE_MSG_SKIP - QUEUE_MSG_ALIGN || QUEUE_MSG_RECORD_SIZE(len) > pObj->bufSize)
+    {
+        return Queue_Error;
+    }
+
+    size_t recordSize = QUEUE_MSG_RECORD_SIZE(len);
+    size_t pad = 0;
+
+    /* While the used region does not wrap, free space is split around it */
+    if (pObj->used == 0 || pObj->rear > pObj->front)
+    {
+        size_t tail = pObj->bufSize - pObj->rear;
+        if (recordSize > tail)
+        {
+            pad = tail;
+        }
+    }
+    if (pad + recordSize > pObj->bufSize - pObj->used)
+    {
+        return Queue_Error;
+    }
+
+    /* Skip the tail so that the record stays contiguous */
+    if (pad > 0)
+    {
+        *QueueMsg_Header(pObj, pObj->rear) = QUEUE_MSG_SKIP;
+        pObj->rear = 0;
+        pObj->used += pad;
+    }
+
+    /* Push the record into the queue */
+    *QueueMsg_Header(pObj, pObj->rear) = (uint32_t)len;
+    memcpy(&pObj->pBuf[pObj->rear + sizeof(uint32_t)], pDataInVoid, len);
+
+    /* Increment cursor around buffer */
+    pObj->rear += recordSize;
+    if (pObj->rear == pObj->bufSize)
+    {
+        pObj->rear = 0;
+    }
+    pObj->used += recordSize;
+    pObj->count++;
+
+    return Queue_Error_None;
+}
+
+Queue_Error_e QueueMsg_PeekBytes(QueueMsg_t *pObj, const void **ppData, size_t *pLen)
+{
+    if (QueueMsg_IsEmpty(pObj))
+    {
+        return Queue_Error;
+    }
+
+    size_t record = QueueMsg_FrontRecord(pObj);
+    *ppData = &pObj->pBuf[record + sizeof(uint32_t)];
+    *pLen = *QueueMsg_Header(pObj, record);
+
+    return Queue_Error_None;
+}
+
+Queue_Error_e QueueMsg_PopBytes(QueueMsg_t *pObj, void *pDataOutVoid, size_t maxLen, size_t *pLen)
+{
+    if (QueueMsg_IsEmpty(pObj))
+    {
+        return Queue_Error;
+    }
+
+    size_t record = QueueMsg_FrontRecord(pObj);
+    size_t len = *QueueMsg_Header(pObj, record);
+    if (pLen != NULL)
+    {
+        *pLen = len;
+    }
+
+    /* Pop the record off the queue */
+    if (pDataOutVoid != NULL)
+    {
+        if (len > maxLen)
+        {
+            return Queue_Error;
+        }
+        memcpy(pDataOutVoid, &pObj->pBuf[record + sizeof(uint32_t)], len);
+    }
+
+    /* Release the skipped tail along with the record */
+    if (record != pObj->front)
+    {
+        pObj->used -= pObj->bufSize - pObj->front;
+    }
+    pObj->front = record + QUEUE_MSG_RECORD_SIZE(len);
+    if (pObj->front == pObj->bufSize)
+    {
+        pObj->front = 0;
+    }
+    pObj->used -= QUEUE_MSG_RECORD_SIZE(len);
+    pObj->count--;
+
+    /* Restart at the top of an empty buffer for the longest contiguous run */
+    if (pObj->count == 0)
+    {
+        pObj->front = 0;
+        pObj->rear = 0;
+    }
+
+    return Queue_Error_None;
+}
@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * @file  queue_msg.h
+ *
+ * @brief Variable-length message queue public function declarations
+ *
+ * @details  Holds messages of any length in one buffer without sizing every
+ *           slot for the largest message. Every message is stored
+ *           contiguously so it can be read in place with QueueMsg_PeekBytes().
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef QUEUE_MSG_H_INCLUDED
+#define QUEUE_MSG_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "queue_msg_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Initializes the message queue object
+ *
+ * @details  The caller is responsible for allocating the queue object, and
+ *           queue buffer.
+ *
+ * @param pObj      Pointer to the queue object
+ * @param pBuf      Pointer to the queue buffer. Must be aligned to
+ *                  QUEUE_MSG_ALIGN
+ * @param bufSize   Queue buffer size. Must be a multiple of QUEUE_MSG_ALIGN
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueMsg_Init(QueueMsg_t *pObj, void *pBuf, size_t bufSize);
+
+/*******************************************************************************
+ * @brief  Check if the queue is empty
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns true if empty
+ ******************************************************************************/
+bool QueueMsg_IsEmpty(QueueMsg_t *pObj);
+
+/*******************************************************************************
+ * @brief  Number of messages in the queue
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns Message count
+ ******************************************************************************/
+size_t QueueMsg_Count(QueueMsg_t *pObj);
+
+/*******************************************************************************
+ * @brief  Pushes a message onto the queue
+ *
+ * @param pObj         Pointer to the queue object
+ * @param pDataInVoid  Pointer to the message
+ * @param len          Length of the message in bytes. May be zero.
+ *
+ * @returns Queue error flag. Queue_Error if there is not enough contiguous
+ *          room for the record.
+ ******************************************************************************/
+Queue_Error_e QueueMsg_PushBytes(QueueMsg_t *pObj, void *pDataInVoid, size_t len);
+
+/*******************************************************************************
+ * @brief  Get a reference to the message on the top of the queue
+ *
+ * @details  The message stays valid until it is popped.
+ *
+ * @param pObj    Pointer to the queue object
+ * @param ppData  Receives a pointer to the message inside the queue buffer
+ * @param pLen    Receives the length of the message in bytes
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueMsg_PeekBytes(QueueMsg_t *pObj, const void **ppData, size_t *pLen);
+
+/*******************************************************************************
+ * @brief  Pops the message on the top of the queue
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Receives the message, or NULL to discard it
+ * @param maxLen        Size of the pDataOutVoid buffer
+ * @param pLen          Receives the length of the message. May be NULL.
+ *
+ * @returns Queue error flag. Queue_Error if empty, or if the message is
+ *          longer than maxLen, in which case it stays queued and pLen
+ *          receives the length required.
+ ******************************************************************************/
+Queue_Error_e QueueMsg_PopBytes(QueueMsg_t *pObj, void *pDataOutVoid, size_t maxLen, size_t *pLen);
+
+#endif /* QUEUE_MSG_H_INCLUDED */
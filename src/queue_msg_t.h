@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * @file  queue_msg_t.h
+ *
+ * @brief Variable-length message queue type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef QUEUE_MSG_T_H_INCLUDED
+#define QUEUE_MSG_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "queue_t.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/**
+ * @brief Records start on this alignment, and so do their payloads
+**/
+#define QUEUE_MSG_ALIGN        sizeof(uint32_t)
+
+/**
+ * @brief Bytes a message of `len` bytes occupies in the buffer
+**/
+#define QUEUE_MSG_RECORD_SIZE(len)                                             \
+    ((sizeof(uint32_t) + (len) + QUEUE_MSG_ALIGN - 1) & ~(QUEUE_MSG_ALIGN - 1))
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Variable-length message queue object
+ *
+ * @details  Each record is a uint32_t length header followed by the payload,
+ *           padded to QUEUE_MSG_ALIGN. A record never wraps: if it does not fit
+ *           before the end of the buffer, a skip marker fills the tail and the
+ *           record starts over at offset 0.
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _QueueMsg_t
+{
+    size_t   front;    /*!< Offset of the front (oldest) record */
+    size_t   rear;     /*!< Offset where the next record is written */
+    size_t   used;     /*!< Bytes in use, including headers, padding and skips */
+    size_t   count;    /*!< Number of queued messages */
+    uint8_t *pBuf;     /*!< Pointer to the queue buffer */
+    size_t   bufSize;  /*!< Size of the queue buffer */
+} QueueMsg_t;
+
+#endif /* QUEUE_MSG_T_H_INCLUDED */
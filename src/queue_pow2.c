@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * @file  queue_pow2.c
+ *
+ * @brief Power-of-two queue implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include "queue_pow2.h"
+#include "queue_copy.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/* Slot that a free-running counter maps onto */
+static inline uint8_t *QueuePow2_Slot(QueuePow2_t *pObj, uint64_t counter)
+{
+    return &pObj->pBuf[(size_t)(counter & pObj->mask) * pObj->dataSize];
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Queue_Error_e QueuePow2_Init(QueuePow2_t *pObj, void *pBuf, size_t bufSize, size_t dataSize)
+{
+    if (dataSize == 0 || bufSize % dataSize != 0)
+    {
+        return Queue_Error;
+    }
+
+    size_t capacity = bufSize / dataSize;
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0)
+    {
+        return Queue_Error;
+    }
+
+    pObj->head = 0;
+    pObj->tail = 0;
+    pObj->pBuf = pBuf;
+    pObj->mask = capacity - 1;
+    pObj->dataSize = dataSize;
+    pObj->pfnCopy = Queue_Copy_Select(dataSize);
+
+    return Queue_Error_None;
+}
+
+bool QueuePow2_IsEmpty(QueuePow2_t *pObj)
+{
+    return (pObj->tail == pObj->head);
+}
+
+bool QueuePow2_IsFull(QueuePow2_t *pObj)
+{
+    return (pObj->tail - pObj->head > pObj->mask);
+}
+
+size_t QueuePow2_Count(QueuePow2_t *pObj)
+{
+    return (size_t)(pObj->tail - pObj->head);
+}
+
+Queue_Error_e QueuePow2_Push(QueuePow2_t *pObj, void *pDataInVoid)
+{
+    if (QueuePow2_IsFull(pObj))
+    {
+        return Queue_Error;
+    }
+
+    pObj->pfnCopy(QueuePow2_Slot(pObj, pObj->tail), pDataInVoid, pObj->dataSize);
+    pObj->tail++;
+
+    return Queue_Error_None;
+}
+
+Queue_Error_e QueuePow2_Pop(QueuePow2_t *pObj, void *pDataOutVoid)
+{
+    if (QueuePow2_IsEmpty(pObj))
+    {
+        return Queue_Error;
+    }
+
+    pObj->pfnCopy(pDataOutVoid, QueuePow2_Slot(pObj, pObj->head), pObj->dataSize);
+    pObj->head++;
+
+    return Queue_Error_None;
+}
+
+Queue_Error_e QueuePow2_Peek(QueuePow2_t *pObj, void *pDataOutVoid)
+{
+    if (QueuePow2_IsEmpty(pObj))
+    {
+        return Queue_Error;
+    }
+
+    /* Copy the data out without updating object state */
+    pObj->pfnCopy(pDataOutVoid, QueuePow2_Slot(pObj, pObj->head), pObj->dataSize);
+
+    return Queue_Error_None;
+}
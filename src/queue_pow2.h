@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * @file  queue_pow2.h
+ *
+ * @brief Power-of-two queue public function declarations
+ *
+ * @details  Same behavior as the plain queue, but the capacity in elements
+ *           must be a power of two. In exchange full, empty and count are
+ *           single subtractions and the hot path has no wrap or sentinel
+ *           branches.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef QUEUE_POW2_H_INCLUDED
+#define QUEUE_POW2_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "queue_pow2_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Initializes the power-of-two queue object
+ *
+ * @details  The caller is responsible for allocating the queue object, and
+ *           queue buffer.
+ *
+ * @param pObj      Pointer to the queue object
+ * @param pBuf      Pointer to the queue buffer
+ * @param bufSize   Queue buffer size. bufSize / dataSize must be a power of two
+ * @param dataSize  Size of the data type that the queue is handling
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueuePow2_Init(QueuePow2_t *pObj, void *pBuf, size_t bufSize, size_t dataSize);
+
+/*******************************************************************************
+ * @brief  Check if the queue is empty
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns true if empty
+ ******************************************************************************/
+bool QueuePow2_IsEmpty(QueuePow2_t *pObj);
+
+/*******************************************************************************
+ * @brief Check if the queue is full
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns true if full
+ ******************************************************************************/
+bool QueuePow2_IsFull(QueuePow2_t *pObj);
+
+/*******************************************************************************
+ * @brief  Number of elements in the queue
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns Element count
+ ******************************************************************************/
+size_t QueuePow2_Count(QueuePow2_t *pObj);
+
+/*******************************************************************************
+ * @brief  Pushes some data type onto the queue
+ *
+ * @param pObj         Pointer to the queue object
+ * @param pDataInVoid  Pointer to the data that will be pushed onto the queue
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueuePow2_Push(QueuePow2_t *pObj, void *pDataInVoid);
+
+/*******************************************************************************
+ * @brief  Pops some data type off the queue
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to the data that will be popped off the queue
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueuePow2_Pop(QueuePow2_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Peek at the data on the top of the queue
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to the peeked data
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueuePow2_Peek(QueuePow2_t *pObj, void *pDataOutVoid);
+
+#endif /* QUEUE_POW2_H_INCLUDED */
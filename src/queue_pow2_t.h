@@ -0,0 +1,42 @@
+/*******************************************************************************
+ * @file  queue_pow2_t.h
+ *
+ * @brief Power-of-two queue type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef QUEUE_POW2_T_H_INCLUDED
+#define QUEUE_POW2_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "queue_t.h"
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Power-of-two queue object
+ *
+ * @details  `head` and `tail` count every element ever popped and pushed.
+ *           They never wrap in practice, so the element count is always
+ *           `tail - head` and slots are found by masking, with no sentinel.
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _QueuePow2_t
+{
+    uint64_t     head;     /*!< Number of elements popped so far */
+    uint64_t     tail;     /*!< Number of elements pushed so far */
+    uint8_t     *pBuf;     /*!< Pointer to the queue buffer */
+    uint64_t     mask;     /*!< Capacity in elements minus one */
+    size_t       dataSize; /*!< Size of the data type to be stored in the queue */
+    Queue_Copy_f pfnCopy;  /*!< Element copy routine selected for dataSize */
+} QueuePow2_t;
+
+#endif /* QUEUE_POW2_T_H_INCLUDED */
@@ -0,0 +1,189 @@
+/*******************************************************************************
+ * @file  queue_prio.c
+ *
+ * @brief Priority queue implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <string.h>
+
+#include "queue_prio.h"
+#include "queue_copy.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/* Element in a heap slot */
+static inline uint8_t *QueuePrio_Slot(QueuePrio_t *pObj, size_t index)
+{
+    return &pObj->pBuf[index * pObj->dataSize];
+}
+
+/* True if pA must be popped before pB */
+static inline bool QueuePrio_Before(QueuePrio_t *pObj, const uint8_t *pA, const uint8_t *pB)
+{
+    if (pObj->pfnCompare != NULL)
+    {
+        return pObj->pfnCompare(pA, pB) < 0;
+    }
+
+    int64_t keyA;
+    int64_t keyB;
+    memcpy(&keyA, pA + pObj->keyOffset, sizeof(keyA));
+    memcpy(&keyB, pB + pObj->keyOffset, sizeof(keyB));
+
+    return keyA < keyB;
+}
+
+/* Shared by both init paths */
+static Queue_Error_e QueuePrio_InitCommon(QueuePrio_t *pObj, void *pBuf, size_t bufSize, size_t dataSize)
+{
+    if (dataSize == 0 || bufSize % dataSize != 0)
+    {
+        return Queue_Error;
+    }
+
+    pObj->pBuf = pBuf;
+    pObj->count = 0;
+    pObj->capacity = bufSize / dataSize;
+    pObj->dataSize = dataSize;
+    pObj->pfnCopy = Queue_Copy_Select(dataSize);
+
+    return Queue_Error_None;
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Queue_Error_e QueuePrio_Init(QueuePrio_t *pObj, void *pBuf, size_t bufSize, size_t dataSize,
+                             QueuePrio_Compare_f pfnCompare)
+{
+    if (pfnCompare == NULL)
+    {
+        return Queue_Error;
+    }
+    pObj->pfnCompare = pfnCompare;
+    pObj->keyOffset = 0;
+
+    return QueuePrio_InitCommon(pObj, pBuf, bufSize, dataSize);
+}
+
+Queue_Error_e QueuePrio_InitKey(QueuePrio_t *pObj, void *pBuf, size_t bufSize, size_t dataSize,
+                                size_t keyOffset)
+{
+    if (dataSize < sizeof(int64_t) || keyOffset > dataSize - sizeof(int64_t))
+    {
+        return Queue_Error;
+    }
+    pObj->pfnCompare = NULL;
+    pObj->keyOffset = keyOffset;
+
+    return QueuePrio_InitCommon(pObj, pBuf, bufSize, dataSize);
+}
+
+bool QueuePrio_IsEmpty(QueuePrio_t *pObj)
+{
+    return (pObj->count == 0);
+}
+
+bool QueuePrio_IsFull(QueuePrio_t *pObj)
+{
+    return (pObj->count == pObj->capacity);
+}
+
+size_t QueuePrio_Count(QueuePrio_t *pObj)
+{
+    return pObj->count;
+}
+
+Queue_Error_e QueuePrio_Push(QueuePrio_t *pObj, void *pDataInVoid)
+{
+    if (QueuePrio_IsFull(pObj))
+    {
+        return Queue_Error;
+    }
+
+    /* Sift a hole up from the new leaf, moving parents down into it, and
+     * only copy the new element once its slot is known */
+    size_t hole = pObj->count++;
+    while (hole > 0)
+    {
+        size_t parent = (hole - 1) / QUEUE_PRIO_ARITY;
+        uint8_t *pParent = QueuePrio_Slot(pObj, parent);
+        if (!QueuePrio_Before(pObj, pDataInVoid, pParent))
+        {
+            break;
+        }
+        pObj->pfnCopy(QueuePrio_Slot(pObj, hole), pParent, pObj->dataSize);
+        hole = parent;
+    }
+    pObj->pfnCopy(QueuePrio_Slot(pObj, hole), pDataInVoid, pObj->dataSize);
+
+    return Queue_Error_None;
+}
+
+Queue_Error_e QueuePrio_Pop(QueuePrio_t *pObj, void *pDataOutVoid)
+{
+    if (QueuePrio_Peek(pObj, pDataOutVoid) != Queue_Error_None)
+    {
+        return Queue_Error;
+    }
+
+    /* Sift the root hole down, pulling the best child up into it, until the
+     * last element fits. The last slot is past the new count, so the hole
+     * never reaches it and it needs no temporary copy. */
+    size_t count = --pObj->count;
+    uint8_t *pLast = QueuePrio_Slot(pObj, count);
+    size_t hole = 0;
+    for (;;)
+    {
+        size_t first = hole * QUEUE_PRIO_ARITY + 1;
+        if (first >= count)
+        {
+            break;
+        }
+
+        size_t end = (count - first < QUEUE_PRIO_ARITY) ? count : first + QUEUE_PRIO_ARITY;
+        size_t best = first;
+        for (size_t child = first + 1; child < end; child++)
+        {
+            if (QueuePrio_Before(pObj, QueuePrio_Slot(pObj, child), QueuePrio_Slot(pObj, best)))
+            {
+                best = child;
+            }
+        }
+
+        uint8_t *pBest = QueuePrio_Slot(pObj, best);
+        if (!QueuePrio_Before(pObj, pBest, pLast))
+        {
+            break;
+        }
+        pObj->pfnCopy(QueuePrio_Slot(pObj, hole), pBest, pObj->dataSize);
+        hole = best;
+    }
+    if (hole != count)
+    {
+        pObj->pfnCopy(QueuePrio_Slot(pObj, hole), pLast, pObj->dataSize);
+    }
+
+    return Queue_Error_None;
+}
+
+Queue_Error_e QueuePrio_Peek(QueuePrio_t *pObj, void *pDataOutVoid)
+{
+    if (QueuePrio_IsEmpty(pObj))
+    {
+        return Queue_Error;
+    }
+
+    /* Copy the data out without updating object state */
+    pObj->pfnCopy(pDataOutVoid, pObj->pBuf, pObj->dataSize);
+
+    return Queue_Error_None;
+}
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * @file  queue_prio.h
+ *
+ * @brief Priority queue public function declarations
+ *
+ * @details  Same shape as the queue in queue.h, but Pop and Peek return the
+ *           highest priority element rather than the oldest. Push and Pop are
+ *           O(log n). Elements of equal priority come out in no particular
+ *           order.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef QUEUE_PRIO_H_INCLUDED
+#define QUEUE_PRIO_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "queue_prio_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Initializes the priority queue object with a comparator
+ *
+ * @param pObj        Pointer to the queue object
+ * @param pBuf        Pointer to the queue buffer
+ * @param bufSize     Queue buffer size. Must be an integer multiple of datasize
+ * @param dataSize    Size of the data type that the queue is handling
+ * @param pfnCompare  Comparator. The element it ranks lowest is popped first.
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueuePrio_Init(QueuePrio_t *pObj, void *pBuf, size_t bufSize, size_t dataSize,
+                             QueuePrio_Compare_f pfnCompare);
+
+/*******************************************************************************
+ * @brief  Initializes the priority queue object to order by an integer key
+ *
+ * @details  Fast path that compares keys inline instead of calling through a
+ *           comparator. The smallest key is popped first.
+ *
+ * @param pObj       Pointer to the queue object
+ * @param pBuf       Pointer to the queue buffer
+ * @param bufSize    Queue buffer size. Must be an integer multiple of datasize
+ * @param dataSize   Size of the data type that the queue is handling
+ * @param keyOffset  Offset of an int64_t key within each element
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueuePrio_InitKey(QueuePrio_t *pObj, void *pBuf, size_t bufSize, size_t dataSize,
+                                size_t keyOffset);
+
+/*******************************************************************************
+ * @brief  Check if the queue is empty
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns true if empty
+ ******************************************************************************/
+bool QueuePrio_IsEmpty(QueuePrio_t *pObj);
+
+/*******************************************************************************
+ * @brief Check if the queue is full
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns true if full
+ ******************************************************************************/
+bool QueuePrio_IsFull(QueuePrio_t *pObj);
+
+/*******************************************************************************
+ * @brief  Number of elements in the queue
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns Number of queued elements
+ ******************************************************************************/
+size_t QueuePrio_Count(QueuePrio_t *pObj);
+
+/*******************************************************************************
+ * @brief  Pushes some data type onto the queue
+ *
+ * @param pObj         Pointer to the queue object
+ * @param pDataInVoid  Pointer to the data that will be pushed onto the queue
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueuePrio_Push(QueuePrio_t *pObj, void *pDataInVoid);
+
+/*******************************************************************************
+ * @brief  Pops the highest priority data type off the queue
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to the data that will be popped off the queue
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueuePrio_Pop(QueuePrio_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Peek at the highest priority data on the queue
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to the peeked data
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueuePrio_Peek(QueuePrio_t *pObj, void *pDataOutVoid);
+
+#endif /* QUEUE_PRIO_H_INCLUDED */
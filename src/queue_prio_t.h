@@ -0,0 +1,62 @@
+/*******************************************************************************
+ * @file  queue_prio_t.h
+ *
+ * @brief Priority queue type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef QUEUE_PRIO_T_H_INCLUDED
+#define QUEUE_PRIO_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "queue_t.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/**
+ * @brief Children per heap node
+**/
+#define QUEUE_PRIO_ARITY 4u
+
+/*============================================================================*
+ *                              T Y P E D E F S                               *
+ *============================================================================*/
+
+/**
+ * @brief Element comparator. Negative if pA must be popped before pB, like
+ *        the comparator given to qsort().
+**/
+typedef int (*QueuePrio_Compare_f)(const void *pA, const void *pB);
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Priority queue object
+ *
+ * @details  Implicit 4-ary min-heap: the children of slot i are slots
+ *           4i + 1 to 4i + 4, so a node's children share a cache line or two
+ *           and the tree is half as deep as a binary heap.
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _QueuePrio_t
+{
+    uint8_t            *pBuf;       /*!< Pointer to the heap buffer */
+    size_t              count;      /*!< Number of queued elements */
+    size_t              capacity;   /*!< Maximum number of queued elements */
+    size_t              dataSize;   /*!< Size of the data type to be stored in the queue */
+    Queue_Copy_f        pfnCopy;    /*!< Element copy routine selected for dataSize */
+    QueuePrio_Compare_f pfnCompare; /*!< Comparator, or NULL to compare keys */
+    size_t              keyOffset;  /*!< Offset of the int64_t key when pfnCompare is NULL */
+} QueuePrio_t;
+
+#endif /* QUEUE_PRIO_T_H_INCLUDED */
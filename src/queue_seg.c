@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * @file  queue_seg.c
+ *
+ * @brief Segmented queue implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include "queue.h"
+#include "queue_alloc.h"
+#include "queue_seg.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/* Take a segment from the pool, or allocate one if the pool is empty */
+static QueueSeg_Segment_t *QueueSeg_Acquire(QueueSeg_t *pObj)
+{
+    QueueSeg_Segment_t *pSeg = pObj->pFree;
+
+    if (pSeg != NULL)
+    {
+        pObj->pFree = pSeg->pNext;
+        pObj->freeCount--;
+    }
+    else
+    {
+        pSeg = pObj->allocator.pfnAlloc(pObj->allocator.pCtx, sizeof(*pSeg) + pObj->segSize);
+        if (pSeg == NULL)
+        {
+            return NULL;
+        }
+    }
+
+    pSeg->pNext = NULL;
+    Queue_Init(&pSeg->queue, &pSeg[1], pObj->segSize, pObj->dataSize);
+
+    return pSeg;
+}
+
+/* Return a drained segment to the pool, or to the allocator if the pool is full */
+static void QueueSeg_Recycle(QueueSeg_t *pObj, QueueSeg_Segment_t *pSeg)
+{
+    if (pObj->freeCount < pObj->maxFree)
+    {
+        pSeg->pNext = pObj->pFree;
+        pObj->pFree = pSeg;
+        pObj->freeCount++;
+    }
+    else
+    {
+        pObj->allocator.pfnFree(pObj->allocator.pCtx, pSeg, sizeof(*pSeg) + pObj->segSize);
+    }
+}
+
+/* Free every segment on a list */
+static void QueueSeg_FreeList(QueueSeg_t *pObj, QueueSeg_Segment_t *pSeg)
+{
+    while (pSeg != NULL)
+    {
+        QueueSeg_Segment_t *pNext = pSeg->pNext;
+        pObj->allocator.pfnFree(pObj->allocator.pCtx, pSeg, sizeof(*pSeg) + pObj->segSize);
+        pSeg = pNext;
+    }
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Queue_Error_e QueueSeg_Init(QueueSeg_t *pObj, const Queue_Allocator_t *pAllocator,
+                            size_t segElems, size_t dataSize, size_t maxFree)
+{
+    if (dataSize == 0 || segElems == 0 ||
+        segElems > (SIZE_MAX - 1 - sizeof(QueueSeg_Segment_t)) / dataSize)
+    {
+        return Queue_Error;
+    }
+
+    pObj->allocator = (pAllocator != NULL) ? *pAllocator : Queue_Allocator_Default;
+    pObj->pFree = NULL;
+    pObj->freeCount = 0;
+    pObj->maxFree = maxFree;
+    pObj->count = 0;
+    pObj->segSize = segElems * dataSize;
+    pObj->dataSize = dataSize;
+
+    pObj->pHead = QueueSeg_Acquire(pObj);
+    pObj->pTail = pObj->pHead;
+
+    return (pObj->pHead != NULL) ? Queue_Error_None : Queue_Error;
+}
+
+void QueueSeg_Deinit(QueueSeg_t *pObj)
+{
+    QueueSeg_FreeList(pObj, pObj->pHead);
+    QueueSeg_FreeList(pObj, pObj->pFree);
+    pObj->pHead = NULL;
+    pObj->pTail = NULL;
+    pObj->pFree = NULL;
+    pObj->freeCount = 0;
+    pObj->count = 0;
+}
+
+bool QueueSeg_IsEmpty(QueueSeg_t *pObj)
+{
+    return (pObj->count == 0);
+}
+
+size_t QueueSeg_Count(QueueSeg_t *pObj)
+{
+    return pObj->count;
+}
+
+Queue_Error_e QueueSeg_Push(QueueSeg_t *pObj, void *pDataInVoid)
+{
+    if (Queue_IsFull(&pObj->pTail->queue))
+    {
+        QueueSeg_Segment_t *pSeg = QueueSeg_Acquire(pObj);
+        if (pSeg == NULL)
+        {
+            return Queue_Error;
+        }
+        pObj->pTail->pNext = pSeg;
+        pObj->pTail = pSeg;
+    }
+
+    Queue_Push(&pObj->pTail->queue, pDataInVoid);
+    pObj->count++;
+
+    return Queue_Error_None;
+}
+
+Queue_Error_e QueueSeg_Pop(QueueSeg_t *pObj, void *pDataOutVoid)
+{
+    QueueSeg_Segment_t *pHead = pObj->pHead;
+
+    if (Queue_Pop(&pHead->queue, pDataOutVoid) != Queue_Error_None)
+    {
+        return Queue_Error;
+    }
+    pObj->count--;
+
+    /* The last segment stays linked and simply wraps as a ring */
+    if (pHead != pObj->pTail && Queue_IsEmpty(&pHead->queue))
+    {
+        pObj->pHead = pHead->pNext;
+        QueueSeg_Recycle(pObj, pHead);
+    }
+
+    return Queue_Error_None;
+}
+
+Queue_Error_e QueueSeg_Peek(QueueSeg_t *pObj, void *pDataOutVoid)
+{
+    return Queue_Peek(&pObj->pHead->queue, pDataOutVoid);
+}
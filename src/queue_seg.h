@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * @file  queue_seg.h
+ *
+ * @brief Segmented queue public function declarations
+ *
+ * @details  Unbounded queue built from a linked list of fixed-size ring
+ *           segments. Growing links one more segment instead of reallocating
+ *           and copying, so push and pop cost does not depend on depth and a
+ *           backlog spike never stalls on a large copy. Drained segments are
+ *           kept in a free pool for reuse.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef QUEUE_SEG_H_INCLUDED
+#define QUEUE_SEG_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "queue_seg_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Initializes the segmented queue object and allocates its first
+ *         segment
+ *
+ * @param pObj        Pointer to the queue object
+ * @param pAllocator  Allocator callbacks, copied into the object. NULL uses
+ *                    malloc(), realloc() and free().
+ * @param segElems    Capacity of each segment in elements
+ * @param dataSize    Size of the data type that the queue is handling
+ * @param maxFree     Number of drained segments kept for reuse. Any beyond this
+ *                    are returned to the allocator.
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueSeg_Init(QueueSeg_t *pObj, const Queue_Allocator_t *pAllocator,
+                            size_t segElems, size_t dataSize, size_t maxFree);
+
+/*******************************************************************************
+ * @brief  Releases every segment, including the free pool. Queued data is
+ *         discarded.
+ *
+ * @param pObj  Pointer to the queue object
+ ******************************************************************************/
+void QueueSeg_Deinit(QueueSeg_t *pObj);
+
+/*******************************************************************************
+ * @brief  Check if the queue is empty
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns true if empty
+ ******************************************************************************/
+bool QueueSeg_IsEmpty(QueueSeg_t *pObj);
+
+/*******************************************************************************
+ * @brief  Number of elements in the queue
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns Number of queued elements
+ ******************************************************************************/
+size_t QueueSeg_Count(QueueSeg_t *pObj);
+
+/*******************************************************************************
+ * @brief  Pushes some data type onto the queue, linking a new segment when
+ *         the rear one is full
+ *
+ * @param pObj         Pointer to the queue object
+ * @param pDataInVoid  Pointer to the data that will be pushed onto the queue
+ *
+ * @returns Queue error flag. Queue_Error only if a segment could not be
+ *          allocated.
+ ******************************************************************************/
+Queue_Error_e QueueSeg_Push(QueueSeg_t *pObj, void *pDataInVoid);
+
+/*******************************************************************************
+ * @brief  Pops some data type off the queue, recycling the front segment once
+ *         it drains
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to the data that will be popped off the queue
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueSeg_Pop(QueueSeg_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Peek at the data on the top of the queue
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to the peeked data
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueSeg_Peek(QueueSeg_t *pObj, void *pDataOutVoid);
+
+#endif /* QUEUE_SEG_H_INCLUDED */
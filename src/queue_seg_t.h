@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * @file  queue_seg_t.h
+ *
+ * @brief Segmented queue type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef QUEUE_SEG_T_H_INCLUDED
+#define QUEUE_SEG_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "queue_t.h"
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  One fixed-size segment. The ring buffer follows the header in the
+ *         same allocation.
+**/
+typedef struct _QueueSeg_Segment_t
+{
+    struct _QueueSeg_Segment_t *pNext; /*!< Next segment towards the rear, or in the free pool */
+    Queue_t                     queue; /*!< Ring over this segment's buffer */
+} QueueSeg_Segment_t;
+
+/**
+ * @brief  Unbounded segmented queue object
+ *
+ * @details  Segments are linked from pHead (popped from) to pTail (pushed
+ *           to). A drained segment is unlinked onto the free pool rather than
+ *           freed, so a queue at steady state never calls the allocator.
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _QueueSeg_t
+{
+    QueueSeg_Segment_t *pHead;     /*!< Segment holding the front of the queue */
+    QueueSeg_Segment_t *pTail;     /*!< Segment holding the rear of the queue */
+    QueueSeg_Segment_t *pFree;     /*!< Pool of drained segments */
+    size_t              freeCount; /*!< Number of segments in the pool */
+    size_t              maxFree;   /*!< Pool size beyond which drained segments are released */
+    size_t              count;     /*!< Number of queued elements */
+    size_t              segSize;   /*!< Buffer size of each segment */
+    size_t              dataSize;  /*!< Size of the data type to be stored in the queue */
+    Queue_Allocator_t   allocator; /*!< Allocator that owns the segments */
+} QueueSeg_t;
+
+#endif /* QUEUE_SEG_T_H_INCLUDED */
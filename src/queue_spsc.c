@@ -0,0 +1,262 @@
+/*******************************************************************************
+ * @file  queue_spsc.c
+ *
+ * @brief Single-producer/single-consumer queue implementation
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <errno.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "queue_spsc.h"
+#include "queue_copy.h"
+
+/*============================================================================*
+ *                     P R I V A T E    F U N C T I O N S                     *
+ *============================================================================*/
+
+/* Number of bytes in use between two cursors that run over [0, 2 * bufSize) */
+static inline size_t QueueSpsc_Used(QueueSpsc_t *pObj, size_t rear, size_t front)
+{
+    return (rear >= front) ? (rear - front) : (rear + 2 * pObj->bufSize - front);
+}
+
+/* Map a cursor onto its byte offset in the buffer */
+static inline size_t QueueSpsc_Offset(QueueSpsc_t *pObj, size_t cursor)
+{
+    return (cursor >= pObj->bufSize) ? (cursor - pObj->bufSize) : cursor;
+}
+
+/* Step a cursor by one element around [0, 2 * bufSize) */
+static inline size_t QueueSpsc_Next(QueueSpsc_t *pObj, size_t cursor)
+{
+    cursor += pObj->dataSize;
+    return (cursor == 2 * pObj->bufSize) ? 0 : cursor;
+}
+
+/* Hint to the CPU that we are busy waiting */
+static inline void QueueSpsc_CpuRelax(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
+
+/* Bump a futex word and wake the thread parked on it */
+static void QueueSpsc_Wake(atomic_uint *pFutex)
+{
+    atomic_fetch_add_explicit(pFutex, 1, memory_order_release);
+    syscall(SYS_futex, pFutex, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+/* Retry an operation, spinning first and then parking on a futex word */
+static Queue_Error_e QueueSpsc_Wait(QueueSpsc_t *pObj,
+                                    Queue_Error_e (*pfnOp)(QueueSpsc_t *, void *),
+                                    void *pData,
+                                    atomic_uint *pFutex,
+                                    atomic_uint *pWaiters,
+                                    const struct timespec *pDeadline)
+{
+    for (uint32_t spin = 0; spin < QUEUE_SPSC_SPIN_COUNT; spin++)
+    {
+        if (pfnOp(pObj, pData) == Queue_Error_None)
+        {
+            return Queue_Error_None;
+        }
+        QueueSpsc_CpuRelax();
+    }
+
+    for (;;)
+    {
+        /* Register before the final retry so a transition cannot be missed */
+        unsigned int seq = atomic_load_explicit(pFutex, memory_order_acquire);
+        atomic_fetch_add_explicit(pWaiters, 1, memory_order_seq_cst);
+        atomic_thread_fence(memory_order_seq_cst);
+
+        if (pfnOp(pObj, pData) == Queue_Error_None)
+        {
+            atomic_fetch_sub_explicit(pWaiters, 1, memory_order_relaxed);
+            return Queue_Error_None;
+        }
+
+        /* FUTEX_WAIT_BITSET takes an absolute CLOCK_MONOTONIC deadline */
+        long rc = syscall(SYS_futex, pFutex, FUTEX_WAIT_BITSET_PRIVATE, seq,
+                          pDeadline, NULL, FUTEX_BITSET_MATCH_ANY);
+        atomic_fetch_sub_explicit(pWaiters, 1, memory_order_relaxed);
+
+        if (rc == -1 && errno == ETIMEDOUT)
+        {
+            return pfnOp(pObj, pData);
+        }
+    }
+}
+
+/* Convert a relative timeout into an absolute CLOCK_MONOTONIC deadline */
+static const struct timespec *QueueSpsc_Deadline(const struct timespec *pTimeout,
+                                                 struct timespec *pDeadline)
+{
+    if (pTimeout == NULL)
+    {
+        return NULL;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, pDeadline);
+    pDeadline->tv_sec += pTimeout->tv_sec;
+    pDeadline->tv_nsec += pTimeout->tv_nsec;
+    if (pDeadline->tv_nsec >= 1000000000L)
+    {
+        pDeadline->tv_sec++;
+        pDeadline->tv_nsec -= 1000000000L;
+    }
+
+    return pDeadline;
+}
+
+/*============================================================================*
+ *                      P U B L I C    F U N C T I O N S                      *
+ *============================================================================*/
+
+Queue_Error_e QueueSpsc_Init(QueueSpsc_t *pObj, void *pBuf, size_t bufSize, size_t dataSize)
+{
+    if (dataSize == 0 || bufSize % dataSize != 0 || bufSize > SIZE_MAX / 2)
+    {
+        return Queue_Error;
+    }
+    atomic_init(&pObj->rear, 0);
+    atomic_init(&pObj->front, 0);
+    pObj->frontCache = 0;
+    pObj->rearCache = 0;
+    atomic_init(&pObj->notEmpty, 0);
+    atomic_init(&pObj->emptyWaiters, 0);
+    atomic_init(&pObj->notFull, 0);
+    atomic_init(&pObj->fullWaiters, 0);
+    pObj->pBuf = pBuf;
+    pObj->bufSize = bufSize;
+    pObj->dataSize = dataSize;
+    pObj->pfnCopy = Queue_Copy_Select(dataSize);
+
+    return Queue_Error_None;
+}
+
+bool QueueSpsc_IsEmpty(QueueSpsc_t *pObj)
+{
+    size_t front = atomic_load_explicit(&pObj->front, memory_order_acquire);
+    size_t rear = atomic_load_explicit(&pObj->rear, memory_order_acquire);
+
+    return (rear == front);
+}
+
+bool QueueSpsc_IsFull(QueueSpsc_t *pObj)
+{
+    size_t rear = atomic_load_explicit(&pObj->rear, memory_order_acquire);
+    size_t front = atomic_load_explicit(&pObj->front, memory_order_acquire);
+
+    return (QueueSpsc_Used(pObj, rear, front) == pObj->bufSize);
+}
+
+Queue_Error_e QueueSpsc_Push(QueueSpsc_t *pObj, void *pDataInVoid)
+{
+    size_t rear = atomic_load_explicit(&pObj->rear, memory_order_relaxed);
+
+    /* Only touch the consumer's cache line when the cached copy says full */
+    if (QueueSpsc_Used(pObj, rear, pObj->frontCache) == pObj->bufSize)
+    {
+        pObj->frontCache = atomic_load_explicit(&pObj->front, memory_order_acquire);
+        if (QueueSpsc_Used(pObj, rear, pObj->frontCache) == pObj->bufSize)
+        {
+            return Queue_Error;
+        }
+    }
+
+    /* Push the data into the queue */
+    uint8_t *pDst = &pObj->pBuf[QueueSpsc_Offset(pObj, rear)];
+    pObj->pfnCopy(pDst, pDataInVoid, pObj->dataSize);
+
+    /* Publish the element to the consumer */
+    atomic_store_explicit(&pObj->rear, QueueSpsc_Next(pObj, rear), memory_order_release);
+
+    /* Wake a parked consumer, but only on the empty to non-empty transition */
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&pObj->emptyWaiters, memory_order_relaxed) != 0 &&
+        atomic_load_explicit(&pObj->front, memory_order_relaxed) == rear)
+    {
+        QueueSpsc_Wake(&pObj->notEmpty);
+    }
+
+    return Queue_Error_None;
+}
+
+Queue_Error_e QueueSpsc_Pop(QueueSpsc_t *pObj, void *pDataOutVoid)
+{
+    if (QueueSpsc_Peek(pObj, pDataOutVoid) != Queue_Error_None)
+    {
+        return Queue_Error;
+    }
+
+    /* Hand the slot back to the producer */
+    size_t front = atomic_load_explicit(&pObj->front, memory_order_relaxed);
+    atomic_store_explicit(&pObj->front, QueueSpsc_Next(pObj, front), memory_order_release);
+
+    /* Wake a parked producer, but only on the full to not-full transition */
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&pObj->fullWaiters, memory_order_relaxed) != 0 &&
+        QueueSpsc_Used(pObj, atomic_load_explicit(&pObj->rear, memory_order_relaxed), front) == pObj->bufSize)
+    {
+        QueueSpsc_Wake(&pObj->notFull);
+    }
+
+    return Queue_Error_None;
+}
+
+Queue_Error_e QueueSpsc_Peek(QueueSpsc_t *pObj, void *pDataOutVoid)
+{
+    size_t front = atomic_load_explicit(&pObj->front, memory_order_relaxed);
+
+    /* Only touch the producer's cache line when the cached copy says empty */
+    if (front == pObj->rearCache)
+    {
+        pObj->rearCache = atomic_load_explicit(&pObj->rear, memory_order_acquire);
+        if (front == pObj->rearCache)
+        {
+            return Queue_Error;
+        }
+    }
+
+    /* Copy the data out without updating object state */
+    uint8_t *pSrc = &pObj->pBuf[QueueSpsc_Offset(pObj, front)];
+    pObj->pfnCopy(pDataOutVoid, pSrc, pObj->dataSize);
+
+    return Queue_Error_None;
+}
+
+Queue_Error_e QueueSpsc_PushWait(QueueSpsc_t *pObj, void *pDataInVoid, const struct timespec *pTimeout)
+{
+    struct timespec deadline;
+
+    return QueueSpsc_PushWaitUntil(pObj, pDataInVoid, QueueSpsc_Deadline(pTimeout, &deadline));
+}
+
+Queue_Error_e QueueSpsc_PushWaitUntil(QueueSpsc_t *pObj, void *pDataInVoid, const struct timespec *pDeadline)
+{
+    return QueueSpsc_Wait(pObj, QueueSpsc_Push, pDataInVoid,
+                          &pObj->notFull, &pObj->fullWaiters, pDeadline);
+}
+
+Queue_Error_e QueueSpsc_PopWait(QueueSpsc_t *pObj, void *pDataOutVoid, const struct timespec *pTimeout)
+{
+    struct timespec deadline;
+
+    return QueueSpsc_PopWaitUntil(pObj, pDataOutVoid, QueueSpsc_Deadline(pTimeout, &deadline));
+}
+
+Queue_Error_e QueueSpsc_PopWaitUntil(QueueSpsc_t *pObj, void *pDataOutVoid, const struct timespec *pDeadline)
+{
+    return QueueSpsc_Wait(pObj, QueueSpsc_Pop, pDataOutVoid,
+                          &pObj->notEmpty, &pObj->emptyWaiters, pDeadline);
+}
@@ -0,0 +1,153 @@
+/*******************************************************************************
+ * @file  queue_spsc.h
+ *
+ * @brief Single-producer/single-consumer queue public function declarations
+ *
+ * @details  Lock-free variant of the queue that may be shared between exactly
+ *           one producer thread and exactly one consumer thread without any
+ *           external locking. Push may only be called from the producer, Pop
+ *           and Peek may only be called from the consumer.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef QUEUE_SPSC_H_INCLUDED
+#define QUEUE_SPSC_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "queue_spsc_t.h"
+
+/*============================================================================*
+ *                 F U N C T I O N    D E C L A R A T I O N S                 *
+ *============================================================================*/
+
+/*******************************************************************************
+ * @brief  Initializes the SPSC queue object
+ *
+ * @details  The caller is responsible for allocating the queue object, and
+ *           queue buffer. Initialization must complete before either thread
+ *           starts using the queue.
+ *
+ * @param pObj      Pointer to the queue object
+ * @param pBuf      Pointer to the queue buffer
+ * @param bufSize   Queue buffer size. Must be an integer multiple of datasize
+ *                  and no larger than SIZE_MAX / 2
+ * @param dataSize  Size of the data type that the queue is handling
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueSpsc_Init(QueueSpsc_t *pObj, void *pBuf, size_t bufSize, size_t dataSize);
+
+/*******************************************************************************
+ * @brief  Check if the queue is empty
+ *
+ * @note   The result may be stale by the time it is used if called from the
+ *         producer.
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns true if empty
+ ******************************************************************************/
+bool QueueSpsc_IsEmpty(QueueSpsc_t *pObj);
+
+/*******************************************************************************
+ * @brief Check if the queue is full
+ *
+ * @note   The result may be stale by the time it is used if called from the
+ *         consumer.
+ *
+ * @param pObj  Pointer to the queue object
+ *
+ * @returns true if full
+ ******************************************************************************/
+bool QueueSpsc_IsFull(QueueSpsc_t *pObj);
+
+/*******************************************************************************
+ * @brief  Pushes some data type onto the queue. Producer only.
+ *
+ * @param pObj         Pointer to the queue object
+ * @param pDataInVoid  Pointer to the data that will be pushed onto the queue
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueSpsc_Push(QueueSpsc_t *pObj, void *pDataInVoid);
+
+/*******************************************************************************
+ * @brief  Pops some data type off the queue. Consumer only.
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to the data that will be popped off the queue
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueSpsc_Pop(QueueSpsc_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Peek at the data on the top of the queue. Consumer only.
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to the peeked data
+ *
+ * @returns Queue error flag
+ ******************************************************************************/
+Queue_Error_e QueueSpsc_Peek(QueueSpsc_t *pObj, void *pDataOutVoid);
+
+/*******************************************************************************
+ * @brief  Pushes some data type onto the queue, waiting while it is full.
+ *         Producer only.
+ *
+ * @details  Retries QUEUE_SPSC_SPIN_COUNT times, then parks on a futex until
+ *           the consumer takes the queue from full to not-full.
+ *
+ * @param pObj         Pointer to the queue object
+ * @param pDataInVoid  Pointer to the data that will be pushed onto the queue
+ * @param pTimeout     Relative timeout, or NULL to wait forever
+ *
+ * @returns Queue error flag. Queue_Error if the timeout expired.
+ ******************************************************************************/
+Queue_Error_e QueueSpsc_PushWait(QueueSpsc_t *pObj, void *pDataInVoid, const struct timespec *pTimeout);
+
+/*******************************************************************************
+ * @brief  Same as QueueSpsc_PushWait() but with an absolute deadline
+ *
+ * @param pObj         Pointer to the queue object
+ * @param pDataInVoid  Pointer to the data that will be pushed onto the queue
+ * @param pDeadline    Absolute CLOCK_MONOTONIC deadline, or NULL to wait forever
+ *
+ * @returns Queue error flag. Queue_Error if the deadline passed.
+ ******************************************************************************/
+Queue_Error_e QueueSpsc_PushWaitUntil(QueueSpsc_t *pObj, void *pDataInVoid, const struct timespec *pDeadline);
+
+/*******************************************************************************
+ * @brief  Pops some data type off the queue, waiting while it is empty.
+ *         Consumer only.
+ *
+ * @details  Retries QUEUE_SPSC_SPIN_COUNT times, then parks on a futex until
+ *           the producer takes the queue from empty to non-empty.
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to the data that will be popped off the queue
+ * @param pTimeout      Relative timeout, or NULL to wait forever
+ *
+ * @returns Queue error flag. Queue_Error if the timeout expired.
+ ******************************************************************************/
+Queue_Error_e QueueSpsc_PopWait(QueueSpsc_t *pObj, void *pDataOutVoid, const struct timespec *pTimeout);
+
+/*******************************************************************************
+ * @brief  Same as QueueSpsc_PopWait() but with an absolute deadline
+ *
+ * @param pObj          Pointer to the queue object
+ * @param pDataOutVoid  Pointer to the data that will be popped off the queue
+ * @param pDeadline     Absolute CLOCK_MONOTONIC deadline, or NULL to wait forever
+ *
+ * @returns Queue error flag. Queue_Error if the deadline passed.
+ ******************************************************************************/
+Queue_Error_e QueueSpsc_PopWaitUntil(QueueSpsc_t *pObj, void *pDataOutVoid, const struct timespec *pDeadline);
+
+#endif /* QUEUE_SPSC_H_INCLUDED */
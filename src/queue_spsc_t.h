@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * @file  queue_spsc_t.h
+ *
+ * @brief Single-producer/single-consumer queue type definitions
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+#ifndef QUEUE_SPSC_T_H_INCLUDED
+#define QUEUE_SPSC_T_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+#include "queue_t.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/**
+ * @brief Cache line size used to keep producer and consumer state apart
+**/
+#ifndef QUEUE_CACHE_LINE_SIZE
+#define QUEUE_CACHE_LINE_SIZE 64
+#endif
+
+/**
+ * @brief Number of retries before a blocking call parks on its futex
+**/
+#ifndef QUEUE_SPSC_SPIN_COUNT
+#define QUEUE_SPSC_SPIN_COUNT 128
+#endif
+
+/*============================================================================*
+ *                             S T R U C T U R E S                            *
+ *============================================================================*/
+
+/**
+ * @brief  Single-producer/single-consumer queue object
+ *
+ * @details  Cursors run over [0, 2 * bufSize) so that full and empty can be
+ *           told apart without a sentinel. The producer only ever writes
+ *           `rear`, the consumer only ever writes `front`, and each side keeps
+ *           a cached copy of the other side's cursor on its own cache line.
+ *
+ * @note   This object should never be directly manipulated by the caller.
+**/
+typedef struct _QueueSpsc_t
+{
+    /* Producer owned */
+    _Alignas(QUEUE_CACHE_LINE_SIZE)
+    atomic_size_t rear;       /*!< Rear (write) cursor, published by the producer */
+    size_t        frontCache; /*!< Producer's last observed front cursor */
+
+    /* Consumer owned */
+    _Alignas(QUEUE_CACHE_LINE_SIZE)
+    atomic_size_t front;      /*!< Front (read) cursor, published by the consumer */
+    size_t        rearCache;  /*!< Consumer's last observed rear cursor */
+
+    /* Blocking waits, only written when a thread parks or is woken */
+    _Alignas(QUEUE_CACHE_LINE_SIZE)
+    atomic_uint   notEmpty;     /*!< Futex word bumped on empty to non-empty */
+    atomic_uint   emptyWaiters; /*!< Consumer parked, or about to park, on notEmpty */
+    atomic_uint   notFull;      /*!< Futex word bumped on full to not-full */
+    atomic_uint   fullWaiters;  /*!< Producer parked, or about to park, on notFull */
+
+    /* Read-only after init */
+    _Alignas(QUEUE_CACHE_LINE_SIZE)
+    uint8_t      *pBuf;       /*!< Pointer to the queue buffer */
+    size_t        bufSize;    /*!< Size of the queue buffer */
+    size_t        dataSize;   /*!< Size of the data type to be stored in the queue */
+    Queue_Copy_f  pfnCopy;    /*!< Element copy routine selected for dataSize */
+} QueueSpsc_t;
+
+#endif /* QUEUE_SPSC_T_H_INCLUDED */
@@ -13,11 +13,22 @@
  *============================================================================*/
 #include <stddef.h>
 #include <stdint.h>
+#include <stdbool.h>
+#ifdef QUEUE_STATS
+#include <stdatomic.h>
+#endif
 
 /*============================================================================*
  *                                D E F I N E S                               *
  *============================================================================*/
 
+/**
+ * @brief Buckets in the occupancy histogram, one per power of two
+ *
+ * @note   Statistics are only collected when QUEUE_STATS is defined
+**/
+#define QUEUE_STATS_BUCKETS (sizeof(size_t) * 8u)
+
 /*============================================================================*
  *                           E N U M E R A T I O N S                          *
  *============================================================================*/
@@ -31,22 +42,116 @@ typedef enum _Queue_Error_e
     Queue_Error      = 1,
 } Queue_Error_e;
 
+/**
+ * @brief Queue_InitEx() flags
+**/
+typedef enum _Queue_Flag_e
+{
+    Queue_Flag_None      = 0,
+    Queue_Flag_Overwrite = 1u << 0, /*!< Push onto a full queue drops the oldest element */
+} Queue_Flag_e;
+
+/*============================================================================*
+ *                              T Y P E D E F S                               *
+ *============================================================================*/
+
+/**
+ * @brief Element copy routine, chosen once per queue from its data size
+**/
+typedef void (*Queue_Copy_f)(void *pDst, const void *pSrc, size_t size);
+
+/**
+ * @brief Element visitor for Queue_Drain(). Returns false to stop draining.
+**/
+typedef bool (*Queue_Drain_f)(void *pCtx, void *pElem);
+
 /*============================================================================*
  *                             S T R U C T U R E S                            *
  *============================================================================*/
 
+/**
+ * @brief  Callbacks run after a Queue_t gains or loses elements
+ *
+ * @details  Installed by add-ons such as Queue_EventOpen() so that the core
+ *           queue carries no OS dependency. Embed this as the first member of
+ *           the add-on's own state.
+**/
+struct _Queue_t;
+typedef struct _Queue_Hooks_t
+{
+    void (*pfnPushed)(struct _Queue_t *pObj, size_t numElems); /*!< After numElems were pushed */
+    void (*pfnPopped)(struct _Queue_t *pObj, size_t numElems); /*!< After numElems were removed */
+} Queue_Hooks_t;
+
+/**
+ * @brief  Memory allocator callbacks for queues that own their buffers
+ *
+ * @details  Sizes are passed back on realloc and free so that sized or arena
+ *           allocators can be plugged in without extra bookkeeping.
+**/
+typedef struct _Queue_Allocator_t
+{
+    void *(*pfnAlloc)(void *pCtx, size_t size);                                 /*!< Allocate a block */
+    void *(*pfnRealloc)(void *pCtx, void *pMem, size_t oldSize, size_t newSize); /*!< Resize a block, keeping its contents */
+    void  (*pfnFree)(void *pCtx, void *pMem, size_t size);                      /*!< Release a block */
+    void   *pCtx;                                                               /*!< Passed to every callback */
+} Queue_Allocator_t;
+
+/**
+ * @brief  Snapshot of a queue's statistics, filled in by Queue_GetStats()
+**/
+typedef struct _Queue_Stats_t
+{
+    uint64_t pushes;       /*!< Elements pushed */
+    uint64_t pops;         /*!< Elements popped */
+    uint64_t fullRejects;  /*!< Queue_Push() calls that failed because the queue was full */
+    uint64_t emptyRejects; /*!< Queue_Pop() calls that failed because the queue was empty */
+    uint64_t highWater;    /*!< Most elements ever queued at once */
+    uint64_t occupancy[QUEUE_STATS_BUCKETS]; /*!< Pushes that left n elements queued, bucket floor(log2(n)) */
+} Queue_Stats_t;
+
+#ifdef QUEUE_STATS
+/**
+ * @brief  Live statistics. Only the queue's owner writes them, other threads
+ *         read them with relaxed loads through Queue_GetStats().
+**/
+typedef struct _Queue_StatsBlock_t
+{
+    atomic_uint_least64_t pushes;
+    atomic_uint_least64_t pops;
+    atomic_uint_least64_t fullRejects;
+    atomic_uint_least64_t emptyRejects;
+    atomic_uint_least64_t highWater;
+    atomic_uint_least64_t occupancy[QUEUE_STATS_BUCKETS];
+} Queue_StatsBlock_t;
+#endif
+
 /**
  * @brief  Queue Object
  *
  * @note   This object should never be directly manipulated by the caller.
+ *
+ * @warning  QUEUE_STATS adds the statistics block to this object, so it
+ *           changes sizeof(Queue_t). It must be defined, or not, identically
+ *           for the library and for every translation unit that includes the
+ *           queue headers. A mismatch is not detected and corrupts memory.
 **/
 typedef struct _Queue_t
 {
-    size_t   front;    /*!< Front (read) buffer cursor */
-    size_t   rear;     /*!< Rear (write) buffer cursor */
-    uint8_t *pBuf;     /*!< Pointer to the queue buffer */
-    size_t   bufSize;  /*!< Size of the queue buffer */
-    size_t   dataSize; /*!< Size of the data type to be stored in the queue */
+    size_t       front;       /*!< Front (read) buffer cursor */
+    size_t       rear;        /*!< Rear (write) buffer cursor */
+    uint8_t     *pBuf;        /*!< Pointer to the queue buffer */
+    size_t       bufSize;     /*!< Size of the queue buffer */
+    size_t       dataSize;    /*!< Size of the data type to be stored in the queue */
+    Queue_Copy_f pfnCopy;     /*!< Element copy routine selected for dataSize */
+    bool         mirrored;    /*!< pBuf[bufSize, 2 * bufSize) aliases pBuf[0, bufSize) */
+    uint32_t     flags;       /*!< Queue_Flag_e bits given at init */
+    uint64_t     overwritten; /*!< Elements dropped by Queue_Flag_Overwrite */
+    Queue_Hooks_t *pHooks;    /*!< Transition callbacks, or NULL */
+    size_t       fdOffset;    /*!< Bytes of the front element already sent by Queue_WriteToFd() */
+#ifdef QUEUE_STATS
+    Queue_StatsBlock_t stats; /*!< Occupancy and rejection counters */
+#endif
 } Queue_t;
 
 #endif /* QUEUE_T_H_INCLUDED */
\ No newline at end of file
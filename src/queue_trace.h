@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * @file  queue_trace.h
+ *
+ * @brief USDT static tracepoints for the queue
+ *
+ * @details  Internal to the queue. When <sys/sdt.h> (systemtap-sdt-dev) is
+ *           available, each probe is a single NOP in the instruction stream
+ *           plus a note in the ELF file, guarded by a semaphore so that its
+ *           arguments are only computed while a tracer is attached. Probes
+ *           live under the `queue` provider:
+ *
+ *           - queue:push   element pushed
+ *           - queue:pop    element popped
+ *           - queue:peek   element peeked
+ *           - queue:full   Queue_Push() rejected, queue full
+ *           - queue:empty  Queue_Pop() or Queue_Peek() rejected, queue empty
+ *
+ *           Every probe carries the queue address, the number of queued
+ *           elements and the data size, e.g.
+ *           `bpftrace -e 'usdt:./app:queue:full { @[arg0] = count(); }'`.
+ *
+ *           Without <sys/sdt.h>, or with QUEUE_NO_TRACE defined, the probes
+ *           compile to nothing.
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef QUEUE_TRACE_H_INCLUDED
+#define QUEUE_TRACE_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#if !defined(QUEUE_NO_TRACE) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#define _SDT_HAS_SEMAPHORES 1
+#include <sys/sdt.h>
+#define QUEUE_TRACE_ENABLED 1
+#endif
+#endif
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+#ifdef QUEUE_TRACE_ENABLED
+
+/**
+ * @brief Define the semaphore a tracer bumps while it is attached to a probe.
+ *        Exactly one translation unit defines each probe's semaphore.
+**/
+#define QUEUE_TRACE_SEMAPHORE(probe)                                           \
+    unsigned short queue_##probe##_semaphore                                   \
+        __attribute__((unused, section(".probes")))
+
+/**
+ * @brief Fire a probe. count is only evaluated while a tracer is attached.
+**/
+#define QUEUE_TRACE(probe, pObj, count)                                        \
+    do                                                                         \
+    {                                                                          \
+        if (__builtin_expect(queue_##probe##_semaphore, 0))                    \
+        {                                                                      \
+            DTRACE_PROBE3(queue, probe, (pObj), (count), (pObj)->dataSize);    \
+        }                                                                      \
+    } while (0)
+
+#else
+
+#define QUEUE_TRACE_SEMAPHORE(probe)  extern int queue_##probe##_semaphore_unused
+#define QUEUE_TRACE(probe, pObj, count) ((void)0)
+
+#endif
+
+#endif /* QUEUE_TRACE_H_INCLUDED */
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * @file  queue_typed.h
+ *
+ * @brief Compile-time typed queue generator
+ *
+ * @details  QUEUE_DEFINE(name, type, capacity) generates a queue type
+ *           `name_t` with an embedded array of `capacity` elements, and
+ *           static inline functions `name_Init`, `name_IsEmpty`,
+ *           `name_IsFull`, `name_Count`, `name_Push`, `name_Pop` and
+ *           `name_Peek`. They behave like their counterparts in queue.h and
+ *           return the same error codes, but elements are moved with plain
+ *           assignment so the compiler can inline and vectorize the copies.
+ *
+ *           Example:
+ *
+ *               QUEUE_DEFINE(SampleQueue, Sample_t, 64)
+ *
+ *               SampleQueue_t q;
+ *               SampleQueue_Init(&q);
+ *               SampleQueue_Push(&q, &sample);
+ *
+ * @author Brooks Anderson <bilbrobaggins@gmail.com>
+ ******************************************************************************/
+
+#ifndef QUEUE_TYPED_H_INCLUDED
+#define QUEUE_TYPED_H_INCLUDED
+
+/*============================================================================*
+ *                              I N C L U D E S                               *
+ *============================================================================*/
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "queue_t.h"
+
+/*============================================================================*
+ *                                D E F I N E S                               *
+ *============================================================================*/
+
+/**
+ * @brief Generate a typed queue named `name` holding `capacity` `type`s
+**/
+#define QUEUE_DEFINE(name, type, capacity)                                     \
+                                                                               \
+typedef struct _##name##_t                                                     \
+{                                                                              \
+    size_t front;           /*!< Index of the front (read) element */          \
+    size_t count;           /*!< Number of queued elements */                  \
+    type   buf[capacity];   /*!< Queue buffer */                               \
+} name##_t;                                                                    \
+                                                                               \
+static inline Queue_Error_e name##_Init(name##_t *pObj)                        \
+{                                                                              \
+    pObj->front = 0;                                                           \
+    pObj->count = 0;                                                           \
+    return Queue_Error_None;                                                   \
+}                                                                              \
+                                                                               \
+static inline bool name##_IsEmpty(const name##_t *pObj)                        \
+{                                                                              \
+    return (pObj->count == 0);                                                 \
+}                                                                              \
+                                                                               \
+static inline bool name##_IsFull(const name##_t *pObj)                         \
+{                                                                              \
+    return (pObj->count == (capacity));                                        \
+}                                                                              \
+                                                                               \
+static inline size_t name##_Count(const name##_t *pObj)                        \
+{                                                                              \
+    return pObj->count;                                                        \
+}                                                                              \
+                                                                               \
+static inline Queue_Error_e name##_Push(name##_t *pObj, const type *pDataIn)   \
+{                                                                              \
+    if (name##_IsFull(pObj))                                                   \
+    {                                                                          \
+        return Queue_Error;                                                    \
+    }                                                                          \
+    size_t rear = pObj->front + pObj->count;                                   \
+    if (rear >= (capacity))                                                    \
+    {                                                                          \
+        rear -= (capacity);                                                    \
+    }                                                                          \
+    pObj->buf[rear] = *pDataIn;                                                \
+    pObj->count++;                                                             \
+    return Queue_Error_None;                                                   \
+}                                                                              \
+                                                                               \
+static inline Queue_Error_e name##_Pop(name##_t *pObj, type *pDataOut)         \
+{                                                                              \
+    if (name##_IsEmpty(pObj))                                                  \
+    {                                                                          \
+        return Queue_Error;                                                    \
+    }                                                                          \
+    *pDataOut = pObj->buf[pObj->front];                                        \
+    if (++pObj->front == (capacity))                                           \
+    {                                                                          \
+        pObj->front = 0;                                                       \
+    }                                                                          \
+    pObj->count--;                                                             \
+    return Queue_Error_None;                                                   \
+}                                                                              \
+                                                                               \
+static inline Queue_Error_e name##_Peek(const name##_t *pObj, type *pDataOut)  \
+{                                                                              \
+    if (name##_IsEmpty(pObj))                                                  \
+    {                                                                          \
+        return Queue_Error;                                                    \
+    }                                                                          \
+    *pDataOut = pObj->buf[pObj->front];                                        \
+    return Queue_Error_None;                                                   \
+}
+
+#endif /* QUEUE_TYPED_H_INCLUDED */
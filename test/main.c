@@ -10,6 +10,20 @@
 #include "greatest.h"
 
 #include "queue_suite.h"
+#include "queue_spsc_suite.h"
+#include "queue_mpmc_suite.h"
+#include "queue_mpsc_suite.h"
+#include "queue_pow2_suite.h"
+#include "queue_typed_suite.h"
+#include "queue_msg_suite.h"
+#include "queue_grow_suite.h"
+#include "queue_seg_suite.h"
+#include "queue_mirror_suite.h"
+#include "queue_file_suite.h"
+#include "queue_prio_suite.h"
+#include "queue_batch_suite.h"
+#include "queue_event_suite.h"
+#include "queue_fd_suite.h"
 
 GREATEST_MAIN_DEFS();
 
@@ -20,6 +34,20 @@ int main(int argc, char **argv)
     printf("\n*********          Begin Unit Tests          *********\n");
 
     RUN_SUITE(Queue_Suite);
+    RUN_SUITE(Queue_Spsc_Suite);
+    RUN_SUITE(Queue_Mpmc_Suite);
+    RUN_SUITE(Queue_Mpsc_Suite);
+    RUN_SUITE(Queue_Pow2_Suite);
+    RUN_SUITE(Queue_Typed_Suite);
+    RUN_SUITE(Queue_Msg_Suite);
+    RUN_SUITE(Queue_Grow_Suite);
+    RUN_SUITE(Queue_Seg_Suite);
+    RUN_SUITE(Queue_Mirror_Suite);
+    RUN_SUITE(Queue_File_Suite);
+    RUN_SUITE(Queue_Prio_Suite);
+    RUN_SUITE(Queue_Batch_Suite);
+    RUN_SUITE(Queue_Event_Suite);
+    RUN_SUITE(Queue_Fd_Suite);
 
     printf("\n*********          End Unit Tests            *********\n");
 
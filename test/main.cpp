@@ -0,0 +1,26 @@
+/**
+ * @file   main.cpp
+ * @author Brooks Anderson
+ * @brief  Unit tests for the C++ header, built separately from main.c
+ */
+
+#include <cstdio>
+
+#include "greatest.h"
+
+#include "queue_hpp_suite.h"
+
+GREATEST_MAIN_DEFS();
+
+int main(int argc, char **argv)
+{
+    GREATEST_MAIN_BEGIN(); /* command-line arguments, initialization. */
+
+    printf("\n*********          Begin C++ Unit Tests      *********\n");
+
+    RUN_SUITE(Queue_Hpp_Suite);
+
+    printf("\n*********          End C++ Unit Tests        *********\n");
+
+    GREATEST_MAIN_END(); /* display results */
+}
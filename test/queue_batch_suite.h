@@ -0,0 +1,160 @@
+#ifndef QUEUE_BATCH_SUITE_INCLUDED
+#define QUEUE_BATCH_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "greatest.h"
+#include "queue_test_helper.h"
+#include "queue_spsc.h"
+#include "queue_batch.h"
+
+/* Declare a local suite. */
+SUITE(Queue_Batch_Suite);
+
+#define QUEUE_BATCH_MAX    (32u)
+
+/* Push until the queue is full, continuing the sequence in *pNext */
+static void Queue_Batch_Fill(QueueSpsc_t *pQ, uint32_t *pNext)
+{
+    while (QueueSpsc_Push(pQ, pNext) == Queue_Error_None)
+    {
+        (*pNext)++;
+    }
+}
+
+TEST Queue_batch_init_fails_if_batch_limits_are_invalid(void)
+{
+    /*****************    Arrange    *****************/
+    QueueSpsc_t q;
+    QueueBatch_t batch;
+    uint32_t buf[4];
+    struct timespec budget = { .tv_sec = 0, .tv_nsec = 1000000 };
+    QueueSpsc_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    Queue_Error_e zeroErr = QueueBatch_Init(&batch, &q, 0, 4, &budget);
+    Queue_Error_e invertedErr = QueueBatch_Init(&batch, &q, 4, 2, &budget);
+    Queue_Error_e err = QueueBatch_Init(&batch, &q, 2, 4, &budget);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, zeroErr);
+    ASSERT_EQ(Queue_Error, invertedErr);
+    ASSERT_EQ(Queue_Error_None, err);
+    ASSERT_EQ(2, QueueBatch_Target(&batch));
+
+    PASS();
+}
+
+TEST Queue_batch_pop_times_out_on_an_empty_queue(void)
+{
+    /*****************    Arrange    *****************/
+    QueueSpsc_t q;
+    QueueBatch_t batch;
+    uint32_t buf[4];
+    uint32_t dataOut[4];
+    struct timespec budget = { .tv_sec = 0, .tv_nsec = 1000000 };
+    struct timespec timeout = { .tv_sec = 0, .tv_nsec = 5000000 };
+    QueueSpsc_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    QueueBatch_Init(&batch, &q, 1, ELEMENTS_IN(dataOut), &budget);
+
+    /*****************     Act       *****************/
+    size_t popped = QueueBatch_Pop(&batch, dataOut, &timeout);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(0, popped);
+    ASSERT_EQ(1, QueueBatch_Target(&batch));
+
+    PASS();
+}
+
+TEST Queue_batch_pop_returns_early_once_the_budget_expires(void)
+{
+    /*****************    Arrange    *****************/
+    QueueSpsc_t q;
+    QueueBatch_t batch;
+    uint32_t buf[8];
+    uint32_t dataIn[] = { 7, 8, 9 };
+    uint32_t dataOut[8];
+    struct timespec budget = { .tv_sec = 0, .tv_nsec = 10000000 };
+    struct timespec start;
+    QueueSpsc_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    QueueBatch_Init(&batch, &q, 8, 8, &budget);
+    for (size_t i = 0; i < ELEMENTS_IN(dataIn); i++)
+    {
+        QueueSpsc_Push(&q, &dataIn[i]);
+    }
+
+    /*****************     Act       *****************/
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    size_t popped = QueueBatch_Pop(&batch, dataOut, NULL);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(3, popped);
+    ASSERT_MEM_EQ(dataIn, dataOut, sizeof(dataIn));
+    ASSERT(Queue_ElapsedNs(&start) >= budget.tv_nsec);
+    ASSERT_EQ(true, QueueSpsc_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Queue_batch_target_grows_under_a_backlog_and_shrinks_when_traffic_is_light(void)
+{
+    /*****************    Arrange    *****************/
+    QueueSpsc_t q;
+    QueueBatch_t batch;
+    uint32_t buf[2 * QUEUE_BATCH_MAX];
+    uint32_t dataOut[QUEUE_BATCH_MAX];
+    uint32_t next = 0;
+    uint32_t expected = 0;
+    uint32_t mismatches = 0;
+    struct timespec budget = { .tv_sec = 0, .tv_nsec = 2000000 };
+    QueueSpsc_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    QueueBatch_Init(&batch, &q, 1, QUEUE_BATCH_MAX, &budget);
+
+    /*****************     Act       *****************/
+    /* Keep the queue full so every batch fills long before the budget */
+    for (uint32_t round = 0; round < 128; round++)
+    {
+        Queue_Batch_Fill(&q, &next);
+        size_t popped = QueueBatch_Pop(&batch, dataOut, NULL);
+        for (size_t i = 0; i < popped; i++)
+        {
+            mismatches += (dataOut[i] != expected++);
+        }
+    }
+    size_t heavyTarget = QueueBatch_Target(&batch);
+
+    /* Then trickle one element per budget */
+    while (!QueueSpsc_IsEmpty(&q))
+    {
+        QueueSpsc_Pop(&q, &dataOut[0]);
+    }
+    for (uint32_t round = 0; round < 48; round++)
+    {
+        nanosleep(&budget, NULL);
+        QueueSpsc_Push(&q, &next);
+        QueueBatch_Pop(&batch, dataOut, NULL);
+    }
+    size_t lightTarget = QueueBatch_Target(&batch);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(0, mismatches);
+    ASSERT_EQ(QUEUE_BATCH_MAX, heavyTarget);
+    ASSERT_EQ(1, lightTarget);
+
+    PASS();
+}
+
+SUITE(Queue_Batch_Suite)
+{
+    /* Unit Tests */
+    RUN_TEST(Queue_batch_init_fails_if_batch_limits_are_invalid);
+    RUN_TEST(Queue_batch_pop_times_out_on_an_empty_queue);
+    RUN_TEST(Queue_batch_pop_returns_early_once_the_budget_expires);
+    RUN_TEST(Queue_batch_target_grows_under_a_backlog_and_shrinks_when_traffic_is_light);
+}
+
+#endif /* QUEUE_BATCH_SUITE_INCLUDED */
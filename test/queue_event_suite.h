@@ -0,0 +1,145 @@
+#ifndef QUEUE_EVENT_SUITE_INCLUDED
+#define QUEUE_EVENT_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include "greatest.h"
+#include "queue_test_helper.h"
+#include "queue.h"
+#include "queue_event.h"
+
+/* Declare a local suite. */
+SUITE(Queue_Event_Suite);
+
+/* True if fd would wake an epoll/poll waiter for EPOLLIN */
+static bool Queue_Event_Ready(int fd)
+{
+    struct pollfd pfd = { .fd = fd, .events = POLLIN };
+
+    return (poll(&pfd, 1, 0) == 1);
+}
+
+/* Value of the eventfd counter, read without disturbing it */
+static uint64_t Queue_Event_Counter(int fd)
+{
+    uint64_t value = 0;
+    if (read(fd, &value, sizeof(value)) == sizeof(value))
+    {
+        ssize_t rc = write(fd, &value, sizeof(value));
+        (void)rc;
+    }
+
+    return value;
+}
+
+TEST Queue_event_fds_are_detached_until_opened(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    Queue_Event_t event;
+    uint8_t buf[4];
+    uint8_t dataIn = 1;
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Queue_Push(&q, &dataIn);
+
+    /*****************     Act       *****************/
+    int readFdBefore = Queue_EventReadFd(&q);
+    Queue_Error_e err = Queue_EventOpen(&q, &event);
+    Queue_Error_e reopenErr = Queue_EventOpen(&q, &event);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(-1, readFdBefore);
+    ASSERT_EQ(Queue_Error_None, err);
+    ASSERT_EQ(Queue_Error, reopenErr);
+    ASSERT_EQ(true, Queue_Event_Ready(Queue_EventReadFd(&q)));
+    ASSERT_EQ(true, Queue_Event_Ready(Queue_EventWriteFd(&q)));
+    Queue_EventClose(&q);
+    ASSERT_EQ(-1, Queue_EventReadFd(&q));
+    ASSERT_EQ(-1, Queue_EventWriteFd(&q));
+
+    PASS();
+}
+
+TEST Queue_event_read_fd_follows_empty_and_coalesces_pushes(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    Queue_Event_t event;
+    uint16_t buf[8];
+    uint16_t dataIn[] = { 1, 2, 3 };
+    uint16_t dataOut[3];
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Queue_EventOpen(&q, &event);
+    int fd = Queue_EventReadFd(&q);
+
+    /*****************     Act       *****************/
+    bool readyWhenEmpty = Queue_Event_Ready(fd);
+    Queue_Push(&q, &dataIn[0]);
+    Queue_PushN(&q, &dataIn[1], 2);
+    uint64_t wakeups = Queue_Event_Counter(fd);
+    Queue_Pop(&q, &dataOut[0]);
+    bool readyWhenPartial = Queue_Event_Ready(fd);
+    Queue_PopN(&q, &dataOut[1], 2);
+    bool readyWhenDrained = Queue_Event_Ready(fd);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(false, readyWhenEmpty);
+    ASSERT_EQ(1, wakeups);
+    ASSERT_EQ(true, readyWhenPartial);
+    ASSERT_EQ(false, readyWhenDrained);
+    ASSERT_MEM_EQ(dataIn, dataOut, sizeof(dataIn));
+    Queue_EventClose(&q);
+
+    PASS();
+}
+
+TEST Queue_event_write_fd_follows_full(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    Queue_Event_t event;
+    uint32_t buf[2];
+    uint32_t dataIn = 9;
+    uint32_t dataOut;
+    size_t numElems;
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Queue_EventOpen(&q, &event);
+    int fd = Queue_EventWriteFd(&q);
+
+    /*****************     Act       *****************/
+    Queue_Push(&q, &dataIn);
+    Queue_Push(&q, &dataIn);
+    bool readyWhenFull = Queue_Event_Ready(fd);
+    Queue_Pop(&q, &dataOut);
+    bool readyAfterPop = Queue_Event_Ready(fd);
+    uint32_t *pSlot = Queue_ReserveWrite(&q, &numElems);
+    *pSlot = dataIn;
+    Queue_CommitWrite(&q, 1);
+    bool readyAfterCommit = Queue_Event_Ready(fd);
+    Queue_Release(&q, 1);
+    bool readyAfterRelease = Queue_Event_Ready(fd);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(false, readyWhenFull);
+    ASSERT_EQ(true, readyAfterPop);
+    ASSERT_EQ(false, readyAfterCommit);
+    ASSERT_EQ(true, readyAfterRelease);
+    ASSERT_EQ(1, Queue_Event_Counter(fd));
+    Queue_EventClose(&q);
+
+    PASS();
+}
+
+SUITE(Queue_Event_Suite)
+{
+    /* Unit Tests */
+    RUN_TEST(Queue_event_fds_are_detached_until_opened);
+    RUN_TEST(Queue_event_read_fd_follows_empty_and_coalesces_pushes);
+    RUN_TEST(Queue_event_write_fd_follows_full);
+}
+
+#endif /* QUEUE_EVENT_SUITE_INCLUDED */
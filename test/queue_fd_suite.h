@@ -0,0 +1,172 @@
+#ifndef QUEUE_FD_SUITE_INCLUDED
+#define QUEUE_FD_SUITE_INCLUDED
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "greatest.h"
+#include "queue_test_helper.h"
+#include "queue.h"
+#include "queue_fd.h"
+
+/* Declare a local suite. */
+SUITE(Queue_Fd_Suite);
+
+#define QUEUE_FD_LARGE_ELEM_SIZE    (40000u)
+
+/* Read whatever is in a non-blocking pipe, returns the number of bytes */
+static size_t Queue_Fd_ReadAll(int fd, uint8_t *pOut, size_t size)
+{
+    size_t total = 0;
+    ssize_t n;
+    while (total < size && (n = read(fd, pOut + total, size - total)) > 0)
+    {
+        total += (size_t)n;
+    }
+
+    return total;
+}
+
+TEST Queue_fd_write_sends_both_runs_across_the_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint16_t buf[4];
+    uint16_t dataIn[] = { 1, 2, 3, 4, 5 };
+    uint16_t dataOut[4] = { 0 };
+    int fds[2];
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Queue_PushN(&q, dataIn, 3);
+    Queue_Release(&q, 2);
+    Queue_PushN(&q, &dataIn[3], 2);
+    ASSERT_EQ(0, pipe(fds));
+
+    /*****************     Act       *****************/
+    ssize_t written = Queue_WriteToFd(&q, fds[1], 10);
+    ssize_t bytesRead = read(fds[0], dataOut, sizeof(dataOut));
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(3, written);
+    ASSERT_EQ(3 * sizeof(uint16_t), bytesRead);
+    ASSERT_MEM_EQ(&dataIn[2], dataOut, 3 * sizeof(uint16_t));
+    ASSERT_EQ(true, Queue_IsEmpty(&q));
+    ASSERT_EQ(0, Queue_WriteToFd(&q, fds[1], 10));
+    close(fds[0]);
+    close(fds[1]);
+
+    PASS();
+}
+
+TEST Queue_fd_write_stops_at_max_elems_and_fails_on_a_bad_fd(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint32_t buf[4];
+    uint32_t dataIn[] = { 10, 20, 30, 40 };
+    uint32_t dataOut[2];
+    int fds[2];
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Queue_PushN(&q, dataIn, ELEMENTS_IN(dataIn));
+    ASSERT_EQ(0, pipe(fds));
+
+    /*****************     Act       *****************/
+    ssize_t written = Queue_WriteToFd(&q, fds[1], 2);
+    ssize_t bytesRead = read(fds[0], dataOut, sizeof(dataOut));
+    ssize_t badWritten = Queue_WriteToFd(&q, -1, 2);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(2, written);
+    ASSERT_EQ(sizeof(dataOut), bytesRead);
+    ASSERT_MEM_EQ(dataIn, dataOut, sizeof(dataOut));
+    ASSERT_EQ(-1, badWritten);
+    ASSERT_EQ(2, Queue_Count(&q));
+    close(fds[0]);
+    close(fds[1]);
+
+    PASS();
+}
+
+TEST Queue_fd_write_rejects_overwrite_queues(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint8_t buf[4];
+    uint8_t dataIn[] = { 1, 2 };
+    int fds[2];
+    Queue_InitEx(&q, buf, sizeof(buf), sizeof(buf[0]), Queue_Flag_Overwrite);
+    Queue_PushN(&q, dataIn, ELEMENTS_IN(dataIn));
+    ASSERT_EQ(0, pipe(fds));
+
+    /*****************     Act       *****************/
+    errno = 0;
+    ssize_t written = Queue_WriteToFd(&q, fds[1], 10);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(-1, written);
+    ASSERT_EQ(EINVAL, errno);
+    ASSERT_EQ(2, Queue_Count(&q));
+    close(fds[0]);
+    close(fds[1]);
+
+    PASS();
+}
+
+TEST Queue_fd_write_resumes_after_a_partial_element(void)
+{
+    /*****************    Arrange    *****************/
+    static uint8_t buf[3 * QUEUE_FD_LARGE_ELEM_SIZE];
+    static uint8_t dataIn[3 * QUEUE_FD_LARGE_ELEM_SIZE];
+    static uint8_t dataOut[3 * QUEUE_FD_LARGE_ELEM_SIZE];
+    Queue_t q;
+    int fds[2];
+    size_t received = 0;
+    ssize_t firstWritten = -1;
+    for (size_t i = 0; i < sizeof(dataIn); i++)
+    {
+        dataIn[i] = (uint8_t)(i * 7 + i / 251);
+    }
+    Queue_Init(&q, buf, sizeof(buf), QUEUE_FD_LARGE_ELEM_SIZE);
+    Queue_PushN(&q, dataIn, 3);
+    ASSERT_EQ(0, pipe(fds));
+    fcntl(fds[0], F_SETFL, O_NONBLOCK);
+    fcntl(fds[1], F_SETFL, O_NONBLOCK);
+
+    /*****************     Act       *****************/
+    /* The pipe holds less than the queue, so writes stop mid element */
+    for (uint32_t round = 0; round < 100 && !Queue_IsEmpty(&q); round++)
+    {
+        ssize_t written = Queue_WriteToFd(&q, fds[1], 3);
+        if (firstWritten < 0)
+        {
+            firstWritten = written;
+        }
+        received += Queue_Fd_ReadAll(fds[0], &dataOut[received], sizeof(dataOut) - received);
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT(firstWritten < 3);
+    ASSERT_EQ(true, Queue_IsEmpty(&q));
+    ASSERT_EQ(sizeof(dataIn), received);
+    ASSERT_MEM_EQ(dataIn, dataOut, sizeof(dataIn));
+    close(fds[0]);
+    close(fds[1]);
+
+    PASS();
+}
+
+SUITE(Queue_Fd_Suite)
+{
+    /* Unit Tests */
+    RUN_TEST(Queue_fd_write_sends_both_runs_across_the_wrap);
+    RUN_TEST(Queue_fd_write_stops_at_max_elems_and_fails_on_a_bad_fd);
+    RUN_TEST(Queue_fd_write_rejects_overwrite_queues);
+
+    /* Integration Tests */
+    RUN_TEST(Queue_fd_write_resumes_after_a_partial_element);
+}
+
+#endif /* QUEUE_FD_SUITE_INCLUDED */
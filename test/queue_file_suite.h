@@ -0,0 +1,275 @@
+#ifndef QUEUE_FILE_SUITE_INCLUDED
+#define QUEUE_FILE_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "greatest.h"
+#include "queue_test_helper.h"
+#include "queue_file.h"
+
+/* Declare a local suite. */
+SUITE(Queue_File_Suite);
+
+/* Reserve a unique path that does not exist yet */
+static void Queue_File_TempPath(char *pPath, size_t size)
+{
+    snprintf(pPath, size, "/tmp/queue_file_XXXXXX");
+    close(mkstemp(pPath));
+    unlink(pPath);
+}
+
+TEST Queue_file_reopen_recovers_queued_elements_in_order(void)
+{
+    /*****************    Arrange    *****************/
+    char path[64];
+    QueueFile_t q;
+    QueueFile_Config_t config = { .syncMode = QueueFile_Sync_Fdatasync, .syncEvery = 4 };
+    uint32_t dataOut[6];
+    Queue_File_TempPath(path, sizeof(path));
+    QueueFile_Open(&q, path, 8, sizeof(uint32_t), &config);
+
+    /* Wrap the slots once before closing */
+    for (uint32_t i = 0; i < 14; i++)
+    {
+        QueueFile_Push(&q, &i);
+        if (i < 8)
+        {
+            QueueFile_Pop(&q, &dataOut[0]);
+        }
+    }
+    QueueFile_Close(&q);
+
+    /*****************     Act       *****************/
+    Queue_Error_e err = QueueFile_Open(&q, path, 0, sizeof(uint32_t), NULL);
+    size_t count = QueueFile_Count(&q);
+    for (uint32_t i = 0; i < 6; i++)
+    {
+        QueueFile_Pop(&q, &dataOut[i]);
+    }
+
+    /*****************    Assert     *****************/
+    uint32_t expected[] = { 8, 9, 10, 11, 12, 13 };
+    ASSERT_EQ(Queue_Error_None, err);
+    ASSERT_EQ(6, count);
+    ASSERT_MEM_EQ(expected, dataOut, sizeof(expected));
+    ASSERT_EQ(true, QueueFile_IsEmpty(&q));
+
+    QueueFile_Close(&q);
+    unlink(path);
+    PASS();
+}
+
+TEST Queue_file_recovery_discards_a_torn_write_and_everything_after_it(void)
+{
+    /*****************    Arrange    *****************/
+    char path[64];
+    QueueFile_t q;
+    uint16_t dataIn[] = { 100, 200, 300, 400 };
+    uint16_t dataOut[2];
+    uint16_t late = 500;
+    Queue_File_TempPath(path, sizeof(path));
+    QueueFile_Open(&q, path, 8, sizeof(uint16_t), NULL);
+    for (size_t i = 0; i < ELEMENTS_IN(dataIn); i++)
+    {
+        QueueFile_Push(&q, &dataIn[i]);
+    }
+    QueueFile_Close(&q);
+
+    /* Tear the third element's payload, as a crash mid-write would */
+    int fd = open(path, O_WRONLY);
+    uint8_t garbage = 0xA5;
+    pwrite(fd, &garbage, 1, QUEUE_FILE_HEADER_SIZE + 2 * QUEUE_FILE_SLOT_SIZE(sizeof(uint16_t)) + 16);
+    close(fd);
+
+    /*****************     Act       *****************/
+    Queue_Error_e err = QueueFile_Open(&q, path, 8, sizeof(uint16_t), NULL);
+    size_t count = QueueFile_Count(&q);
+    QueueFile_Push(&q, &late);
+    QueueFile_Close(&q);
+    QueueFile_Open(&q, path, 8, sizeof(uint16_t), NULL);
+    size_t countAfterReuse = QueueFile_Count(&q);
+    QueueFile_Pop(&q, &dataOut[0]);
+    QueueFile_Pop(&q, &dataOut[1]);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error_None, err);
+    ASSERT_EQ(2, count);
+    ASSERT_EQ(3, countAfterReuse);
+    ASSERT_MEM_EQ(dataIn, dataOut, sizeof(dataOut));
+
+    QueueFile_Close(&q);
+    unlink(path);
+    PASS();
+}
+
+TEST Queue_file_recovery_skips_slots_reused_since_a_stale_header(void)
+{
+    /*****************    Arrange    *****************/
+    char path[64];
+    QueueFile_t q;
+    uint32_t dataOut[4];
+    uint64_t staleFront = 0;
+    Queue_File_TempPath(path, sizeof(path));
+    QueueFile_Open(&q, path, 4, sizeof(uint32_t), NULL);
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        QueueFile_Push(&q, &i);
+    }
+    QueueFile_Pop(&q, &dataOut[0]);
+    QueueFile_Pop(&q, &dataOut[0]);
+    for (uint32_t i = 4; i < 6; i++)
+    {
+        QueueFile_Push(&q, &i);
+    }
+    QueueFile_Close(&q);
+
+    /* Roll the header back to before the pops, as if its page was never
+     * written back while the slot pages were */
+    int fd = open(path, O_WRONLY);
+    pwrite(fd, &staleFront, sizeof(staleFront), offsetof(QueueFile_Header_t, front));
+    close(fd);
+
+    /*****************     Act       *****************/
+    Queue_Error_e err = QueueFile_Open(&q, path, 4, sizeof(uint32_t), NULL);
+    size_t count = QueueFile_Count(&q);
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        QueueFile_Pop(&q, &dataOut[i]);
+    }
+
+    /*****************    Assert     *****************/
+    uint32_t expected[] = { 2, 3, 4, 5 };
+    ASSERT_EQ(Queue_Error_None, err);
+    ASSERT_EQ(4, count);
+    ASSERT_MEM_EQ(expected, dataOut, sizeof(expected));
+    ASSERT_EQ(true, QueueFile_IsEmpty(&q));
+
+    QueueFile_Close(&q);
+    unlink(path);
+    PASS();
+}
+
+TEST Queue_file_open_fails_if_data_size_does_not_match(void)
+{
+    /*****************    Arrange    *****************/
+    char path[64];
+    QueueFile_t q;
+    Queue_File_TempPath(path, sizeof(path));
+    QueueFile_Open(&q, path, 4, sizeof(uint32_t), NULL);
+    QueueFile_Close(&q);
+
+    /*****************     Act       *****************/
+    Queue_Error_e sizeErr = QueueFile_Open(&q, path, 4, sizeof(uint64_t), NULL);
+    Queue_Error_e capacityErr = QueueFile_Open(&q, path, 5, sizeof(uint32_t), NULL);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, sizeErr);
+    ASSERT_EQ(Queue_Error, capacityErr);
+
+    unlink(path);
+    PASS();
+}
+
+TEST Queue_file_open_leaves_no_file_behind_when_it_fails(void)
+{
+    /*****************    Arrange    *****************/
+    char path[64];
+    QueueFile_t q;
+    size_t tooMany = (SIZE_MAX - QUEUE_FILE_HEADER_SIZE) / QUEUE_FILE_SLOT_SIZE(sizeof(uint32_t));
+    Queue_File_TempPath(path, sizeof(path));
+
+    /*****************     Act       *****************/
+    Queue_Error_e noCapacityErr = QueueFile_Open(&q, path, 0, sizeof(uint32_t), NULL);
+    int noCapacityExists = access(path, F_OK);
+    Queue_Error_e tooManyErr = QueueFile_Open(&q, path, tooMany, sizeof(uint32_t), NULL);
+    int tooManyExists = access(path, F_OK);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, noCapacityErr);
+    ASSERT_EQ(-1, noCapacityExists);
+    ASSERT_EQ(Queue_Error, tooManyErr);
+    ASSERT_EQ(-1, tooManyExists);
+
+    PASS();
+}
+
+TEST Queue_file_open_treats_a_zeroed_header_as_a_new_file(void)
+{
+    /*****************    Arrange    *****************/
+    char path[64];
+    QueueFile_t q;
+    uint32_t dataIn = 42;
+    uint32_t dataOut = 0;
+    Queue_File_TempPath(path, sizeof(path));
+
+    /* A crash after sizing but before the header reached the disk */
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    ASSERT_EQ(0, ftruncate(fd, QUEUE_FILE_HEADER_SIZE + 4 * QUEUE_FILE_SLOT_SIZE(sizeof(uint32_t))));
+    close(fd);
+
+    /*****************     Act       *****************/
+    Queue_Error_e err = QueueFile_Open(&q, path, 4, sizeof(uint32_t), NULL);
+    bool wasEmpty = QueueFile_IsEmpty(&q);
+    QueueFile_Push(&q, &dataIn);
+    QueueFile_Close(&q);
+    Queue_Error_e reopenErr = QueueFile_Open(&q, path, 0, sizeof(uint32_t), NULL);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error_None, err);
+    ASSERT_EQ(true, wasEmpty);
+    ASSERT_EQ(Queue_Error_None, reopenErr);
+    ASSERT_EQ(Queue_Error_None, QueueFile_Pop(&q, &dataOut));
+    ASSERT_EQ(dataIn, dataOut);
+
+    QueueFile_Close(&q);
+    unlink(path);
+    PASS();
+}
+
+TEST Queue_file_push_fails_if_overflow_and_pop_fails_if_underflow(void)
+{
+    /*****************    Arrange    *****************/
+    char path[64];
+    QueueFile_t q;
+    QueueFile_Config_t config = { .syncMode = QueueFile_Sync_Msync, .syncEvery = 1 };
+    uint8_t dataIn = 7;
+    uint8_t dataOut;
+    Queue_File_TempPath(path, sizeof(path));
+    QueueFile_Open(&q, path, 2, sizeof(uint8_t), &config);
+
+    /*****************     Act       *****************/
+    Queue_Error_e popErr = QueueFile_Pop(&q, &dataOut);
+    QueueFile_Push(&q, &dataIn);
+    QueueFile_Push(&q, &dataIn);
+    Queue_Error_e pushErr = QueueFile_Push(&q, &dataIn);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, popErr);
+    ASSERT_EQ(Queue_Error, pushErr);
+    ASSERT_EQ(true, QueueFile_IsFull(&q));
+    ASSERT_EQ(Queue_Error_None, QueueFile_Sync(&q));
+
+    QueueFile_Close(&q);
+    unlink(path);
+    PASS();
+}
+
+SUITE(Queue_File_Suite)
+{
+    /* Unit Tests */
+    RUN_TEST(Queue_file_open_fails_if_data_size_does_not_match);
+    RUN_TEST(Queue_file_open_leaves_no_file_behind_when_it_fails);
+    RUN_TEST(Queue_file_open_treats_a_zeroed_header_as_a_new_file);
+    RUN_TEST(Queue_file_push_fails_if_overflow_and_pop_fails_if_underflow);
+    RUN_TEST(Queue_file_recovery_discards_a_torn_write_and_everything_after_it);
+    RUN_TEST(Queue_file_recovery_skips_slots_reused_since_a_stale_header);
+
+    /* Integration Tests */
+    RUN_TEST(Queue_file_reopen_recovers_queued_elements_in_order);
+}
+
+#endif /* QUEUE_FILE_SUITE_INCLUDED */
@@ -0,0 +1,199 @@
+#ifndef QUEUE_GROW_SUITE_INCLUDED
+#define QUEUE_GROW_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "greatest.h"
+#include "queue_test_helper.h"
+#include "queue_grow.h"
+
+/* Declare a local suite. */
+SUITE(Queue_Grow_Suite);
+
+typedef struct _Queue_Grow_Arena_t
+{
+    uint32_t allocs;
+    uint32_t reallocs;
+    uint32_t frees;
+    size_t   live;
+    bool     fail;
+} Queue_Grow_Arena_t;
+
+static void *Queue_Grow_ArenaAlloc(void *pCtx, size_t size)
+{
+    Queue_Grow_Arena_t *pArena = pCtx;
+    if (pArena->fail)
+    {
+        return NULL;
+    }
+    pArena->allocs++;
+    pArena->live += size;
+    return malloc(size);
+}
+
+static void *Queue_Grow_ArenaRealloc(void *pCtx, void *pMem, size_t oldSize, size_t newSize)
+{
+    Queue_Grow_Arena_t *pArena = pCtx;
+    if (pArena->fail)
+    {
+        return NULL;
+    }
+    pArena->reallocs++;
+    pArena->live += newSize - oldSize;
+    return realloc(pMem, newSize);
+}
+
+static void Queue_Grow_ArenaFree(void *pCtx, void *pMem, size_t size)
+{
+    Queue_Grow_Arena_t *pArena = pCtx;
+    pArena->frees++;
+    pArena->live -= size;
+    free(pMem);
+}
+
+TEST Queue_grow_init_fails_if_data_size_is_zero(void)
+{
+    /*****************    Arrange    *****************/
+    QueueGrow_t q;
+
+    /*****************     Act       *****************/
+    Queue_Error_e err = QueueGrow_Init(&q, NULL, 4, 0);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, err);
+
+    PASS();
+}
+
+TEST Queue_grow_push_grows_and_keeps_order_across_the_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    QueueGrow_t q;
+    uint32_t dataOut;
+    uint32_t next = 0;
+    uint32_t mismatches = 0;
+    QueueGrow_Init(&q, NULL, 4, sizeof(uint32_t));
+
+    /*****************     Act       *****************/
+    /* Leave the front part way round so that each growth has to unwrap */
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        QueueGrow_Push(&q, &i);
+    }
+    QueueGrow_Pop(&q, &dataOut);
+    mismatches += (dataOut != next++);
+    for (uint32_t i = 3; i < 100; i++)
+    {
+        ASSERT_EQ(Queue_Error_None, QueueGrow_Push(&q, &i));
+    }
+    size_t count = QueueGrow_Count(&q);
+    size_t capacity = QueueGrow_Capacity(&q);
+    while (QueueGrow_Pop(&q, &dataOut) == Queue_Error_None)
+    {
+        mismatches += (dataOut != next++);
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(99, count);
+    ASSERT_EQ(128, capacity);
+    ASSERT_EQ(0, mismatches);
+    ASSERT_EQ(100, next);
+    ASSERT_EQ(true, QueueGrow_IsEmpty(&q));
+
+    QueueGrow_Deinit(&q);
+    PASS();
+}
+
+TEST Queue_grow_shrinks_back_to_initial_capacity_when_sparse(void)
+{
+    /*****************    Arrange    *****************/
+    QueueGrow_t q;
+    Queue_Grow_Arena_t arena = { 0 };
+    Queue_Allocator_t allocator = {
+        .pfnAlloc = Queue_Grow_ArenaAlloc,
+        .pfnRealloc = Queue_Grow_ArenaRealloc,
+        .pfnFree = Queue_Grow_ArenaFree,
+        .pCtx = &arena,
+    };
+    uint16_t dataIn = 0;
+    uint16_t dataOut;
+    uint16_t next = 0;
+    uint32_t mismatches = 0;
+    QueueGrow_Init(&q, &allocator, 8, sizeof(uint16_t));
+    while (dataIn < 1000)
+    {
+        QueueGrow_Push(&q, &dataIn);
+        dataIn++;
+    }
+    size_t peakCapacity = QueueGrow_Capacity(&q);
+
+    /*****************     Act       *****************/
+    /* Drain, then keep a trickle flowing through the nearly empty queue */
+    for (uint32_t i = 0; i < 2000; i++)
+    {
+        if (i >= 1000)
+        {
+            QueueGrow_Push(&q, &dataIn);
+            dataIn++;
+        }
+        QueueGrow_Pop(&q, &dataOut);
+        mismatches += (dataOut != next++);
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(1024, peakCapacity);
+    ASSERT_EQ(8, QueueGrow_Capacity(&q));
+    ASSERT_EQ(0, mismatches);
+    ASSERT_EQ(8 * sizeof(uint16_t), arena.live);
+    QueueGrow_Deinit(&q);
+    ASSERT_EQ(0, arena.live);
+    ASSERT_EQ(arena.allocs, arena.frees);
+    ASSERT(arena.reallocs > 0);
+
+    PASS();
+}
+
+TEST Queue_grow_push_fails_if_allocator_fails(void)
+{
+    /*****************    Arrange    *****************/
+    QueueGrow_t q;
+    Queue_Grow_Arena_t arena = { 0 };
+    Queue_Allocator_t allocator = {
+        .pfnAlloc = Queue_Grow_ArenaAlloc,
+        .pfnRealloc = Queue_Grow_ArenaRealloc,
+        .pfnFree = Queue_Grow_ArenaFree,
+        .pCtx = &arena,
+    };
+    uint8_t dataIn[] = { 11, 22, 33 };
+    uint8_t dataOut[2];
+    QueueGrow_Init(&q, &allocator, 2, sizeof(uint8_t));
+    QueueGrow_Push(&q, &dataIn[0]);
+    QueueGrow_Push(&q, &dataIn[1]);
+
+    /*****************     Act       *****************/
+    arena.fail = true;
+    Queue_Error_e err = QueueGrow_Push(&q, &dataIn[2]);
+    QueueGrow_Pop(&q, &dataOut[0]);
+    QueueGrow_Pop(&q, &dataOut[1]);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, err);
+    ASSERT_MEM_EQ(dataIn, dataOut, sizeof(dataOut));
+    ASSERT_EQ(true, QueueGrow_IsEmpty(&q));
+
+    QueueGrow_Deinit(&q);
+    PASS();
+}
+
+SUITE(Queue_Grow_Suite)
+{
+    /* Unit Tests */
+    RUN_TEST(Queue_grow_init_fails_if_data_size_is_zero);
+    RUN_TEST(Queue_grow_push_grows_and_keeps_order_across_the_wrap);
+    RUN_TEST(Queue_grow_shrinks_back_to_initial_capacity_when_sparse);
+    RUN_TEST(Queue_grow_push_fails_if_allocator_fails);
+}
+
+#endif /* QUEUE_GROW_SUITE_INCLUDED */
@@ -0,0 +1,186 @@
+#ifndef QUEUE_HPP_SUITE_INCLUDED
+#define QUEUE_HPP_SUITE_INCLUDED
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "greatest.h"
+#include "queue.hpp"
+
+/* Declare a local suite. */
+SUITE(Queue_Hpp_Suite);
+
+/* Counts live instances so destruction of queued elements can be checked */
+struct Queue_Hpp_Tracked
+{
+    static int live;
+
+    int value;
+
+    Queue_Hpp_Tracked(int v, int w) : value(v + w) { live++; }
+    Queue_Hpp_Tracked(Queue_Hpp_Tracked &&other) noexcept : value(other.value) { live++; }
+    Queue_Hpp_Tracked &operator=(Queue_Hpp_Tracked &&other) noexcept
+    {
+        value = other.value;
+        return *this;
+    }
+    Queue_Hpp_Tracked(const Queue_Hpp_Tracked &) = delete;
+    ~Queue_Hpp_Tracked() { live--; }
+};
+
+int Queue_Hpp_Tracked::live = 0;
+
+/* Over-aligned element to exercise the caller buffer alignment */
+struct alignas(32) Queue_Hpp_Wide
+{
+    uint64_t lanes[4];
+};
+
+TEST Queue_hpp_moves_move_only_payloads_in_order_across_the_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    queue::ring<std::unique_ptr<int>, 3> q;
+    std::unique_ptr<int> dataOut;
+    int mismatches = 0;
+
+    /*****************     Act       *****************/
+    for (int i = 0; i < 7; i++)
+    {
+        auto dataIn = std::make_unique<int>(i);
+        if (!q.try_push(std::move(dataIn)) || dataIn != nullptr)
+        {
+            mismatches++;
+        }
+        if (!q.try_pop(dataOut) || *dataOut != i)
+        {
+            mismatches++;
+        }
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(0, mismatches);
+    ASSERT(q.empty());
+    ASSERT_EQ(nullptr, q.peek());
+
+    PASS();
+}
+
+TEST Queue_hpp_push_fails_if_full_and_leaves_the_value_untouched(void)
+{
+    /*****************    Arrange    *****************/
+    queue::ring<std::unique_ptr<int>, 1> q;
+    auto first = std::make_unique<int>(1);
+    auto second = std::make_unique<int>(2);
+    q.try_push(std::move(first));
+
+    /*****************     Act       *****************/
+    bool pushed = q.try_push(std::move(second));
+
+    /*****************    Assert     *****************/
+    ASSERT_FALSE(pushed);
+    ASSERT(q.full());
+    ASSERT(second != nullptr);
+    ASSERT_EQ(2, *second);
+    ASSERT_EQ(1, **q.peek());
+
+    PASS();
+}
+
+TEST Queue_hpp_emplace_constructs_in_place_and_queued_elements_are_destroyed(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_Hpp_Tracked::live = 0;
+    int peeked = 0;
+    int live = 0;
+
+    /*****************     Act       *****************/
+    {
+        queue::ring<Queue_Hpp_Tracked, 4> q;
+        q.try_emplace(1, 10);
+        q.try_emplace(2, 20);
+        q.try_emplace(3, 30);
+        peeked = q.peek()->value;
+        live = Queue_Hpp_Tracked::live;
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(11, peeked);
+    ASSERT_EQ(3, live);
+    ASSERT_EQ(0, Queue_Hpp_Tracked::live);
+
+    PASS();
+}
+
+TEST Queue_hpp_clear_destroys_queued_strings(void)
+{
+    /*****************    Arrange    *****************/
+    queue::ring<std::string, 2> q;
+    q.try_push(std::string(64, 'a'));
+    q.try_push(std::string(64, 'b'));
+
+    /*****************     Act       *****************/
+    q.clear();
+
+    /*****************    Assert     *****************/
+    ASSERT(q.empty());
+    ASSERT(q.try_push(std::string("c")));
+    ASSERT_EQ(std::string("c"), *q.peek());
+
+    PASS();
+}
+
+TEST Queue_hpp_caller_buffer_is_aligned_and_sized_in_whole_elements(void)
+{
+    /*****************    Arrange    *****************/
+    alignas(64) unsigned char buf[4 * sizeof(Queue_Hpp_Wide) + 8];
+    Queue_Hpp_Wide dataIn = { { 1, 2, 3, 4 } };
+    Queue_Hpp_Wide dataOut = {};
+
+    /*****************     Act       *****************/
+    /* Start 8 bytes in, which must be rounded up to the next 32 byte boundary */
+    queue::ring<Queue_Hpp_Wide> q(buf + 8, sizeof(buf) - 8);
+    bool pushed = q.try_push(dataIn);
+    auto address = reinterpret_cast<std::uintptr_t>(q.peek());
+    bool popped = q.try_pop(dataOut);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(3, q.capacity());
+    ASSERT(pushed);
+    ASSERT(popped);
+    ASSERT_EQ(0, address % alignof(Queue_Hpp_Wide));
+    ASSERT_MEM_EQ(&dataIn, &dataOut, sizeof(dataIn));
+
+    PASS();
+}
+
+TEST Queue_hpp_caller_buffer_too_small_for_one_element_has_no_capacity(void)
+{
+    /*****************    Arrange    *****************/
+    alignas(32) unsigned char buf[sizeof(Queue_Hpp_Wide)];
+    Queue_Hpp_Wide dataIn = {};
+
+    /*****************     Act       *****************/
+    queue::ring<Queue_Hpp_Wide> q(buf + 1, sizeof(buf) - 1);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(0, q.capacity());
+    ASSERT(q.full());
+    ASSERT_FALSE(q.try_push(dataIn));
+
+    PASS();
+}
+
+SUITE(Queue_Hpp_Suite)
+{
+    /* Unit Tests */
+    RUN_TEST(Queue_hpp_moves_move_only_payloads_in_order_across_the_wrap);
+    RUN_TEST(Queue_hpp_push_fails_if_full_and_leaves_the_value_untouched);
+    RUN_TEST(Queue_hpp_emplace_constructs_in_place_and_queued_elements_are_destroyed);
+    RUN_TEST(Queue_hpp_clear_destroys_queued_strings);
+    RUN_TEST(Queue_hpp_caller_buffer_is_aligned_and_sized_in_whole_elements);
+    RUN_TEST(Queue_hpp_caller_buffer_too_small_for_one_element_has_no_capacity);
+}
+
+#endif /* QUEUE_HPP_SUITE_INCLUDED */
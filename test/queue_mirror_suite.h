@@ -0,0 +1,126 @@
+#ifndef QUEUE_MIRROR_SUITE_INCLUDED
+#define QUEUE_MIRROR_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "greatest.h"
+#include "queue_test_helper.h"
+#include "queue.h"
+#include "queue_mirror.h"
+
+/* Declare a local suite. */
+SUITE(Queue_Mirror_Suite);
+
+TEST Queue_mirror_rounds_capacity_up_to_whole_pages_of_elements(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    size_t capacity;
+
+    /*****************     Act       *****************/
+    Queue_Error_e err = Queue_InitMirrored(&q, 100, 12);
+    Queue_ReserveWrite(&q, &capacity);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error_None, err);
+    ASSERT(capacity * 12 >= 100);
+    ASSERT_EQ(0, (capacity * 12) % (size_t)sysconf(_SC_PAGESIZE));
+
+    Queue_DeinitMirrored(&q);
+    PASS();
+}
+
+TEST Queue_mirror_peek_ref_and_reserve_write_span_the_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    size_t capacity;
+    Queue_InitMirrored(&q, 1, sizeof(uint32_t));
+    Queue_ReserveWrite(&q, &capacity);
+    uint32_t *pIn = malloc(capacity * sizeof(uint32_t));
+    uint32_t *pOut = malloc(capacity * sizeof(uint32_t));
+    for (uint32_t i = 0; i < capacity; i++)
+    {
+        pIn[i] = i;
+    }
+
+    /* Move both cursors to three quarters of the way round */
+    Queue_PushN(&q, pIn, capacity * 3 / 4);
+    Queue_PopN(&q, pOut, capacity * 3 / 4);
+
+    /*****************     Act       *****************/
+    size_t reserved;
+    uint32_t *pSlots = Queue_ReserveWrite(&q, &reserved);
+    for (size_t i = 0; i < reserved; i++)
+    {
+        pSlots[i] = pIn[i];
+    }
+    Queue_Error_e commitErr = Queue_CommitWrite(&q, reserved);
+    size_t peeked;
+    uint32_t *pFront = Queue_PeekRef(&q, &peeked);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(capacity, reserved);
+    ASSERT_EQ(Queue_Error_None, commitErr);
+    ASSERT_EQ(true, Queue_IsFull(&q));
+    ASSERT_EQ(capacity, peeked);
+    ASSERT_MEM_EQ(pIn, pFront, capacity * sizeof(uint32_t));
+    ASSERT_EQ(Queue_Error_None, Queue_Release(&q, peeked));
+    ASSERT_EQ(true, Queue_IsEmpty(&q));
+
+    free(pIn);
+    free(pOut);
+    Queue_DeinitMirrored(&q);
+    PASS();
+}
+
+TEST Queue_mirror_push_n_and_pop_n_wrap_around_the_buffer(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    size_t capacity;
+    Queue_InitMirrored(&q, 1, sizeof(uint16_t));
+    Queue_ReserveWrite(&q, &capacity);
+    uint16_t *pIn = malloc(capacity * sizeof(uint16_t));
+    uint16_t *pOut = malloc(capacity * sizeof(uint16_t));
+    uint32_t mismatches = 0;
+
+    /*****************     Act       *****************/
+    for (uint32_t lap = 0; lap < 10; lap++)
+    {
+        size_t batch = capacity * 2 / 3;
+        for (size_t i = 0; i < batch; i++)
+        {
+            pIn[i] = (uint16_t)(lap * 1000 + i);
+        }
+        size_t pushed = Queue_PushN(&q, pIn, batch);
+        size_t popped = Queue_PopN(&q, pOut, capacity);
+        mismatches += (pushed != batch) + (popped != batch);
+        mismatches += (memcmp(pIn, pOut, batch * sizeof(uint16_t)) != 0);
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(0, mismatches);
+    ASSERT_EQ(true, Queue_IsEmpty(&q));
+
+    free(pIn);
+    free(pOut);
+    Queue_DeinitMirrored(&q);
+    PASS();
+}
+
+SUITE(Queue_Mirror_Suite)
+{
+    /* Unit Tests */
+    RUN_TEST(Queue_mirror_rounds_capacity_up_to_whole_pages_of_elements);
+    RUN_TEST(Queue_mirror_peek_ref_and_reserve_write_span_the_wrap);
+
+    /* Integration Tests */
+    RUN_TEST(Queue_mirror_push_n_and_pop_n_wrap_around_the_buffer);
+}
+
+#endif /* QUEUE_MIRROR_SUITE_INCLUDED */
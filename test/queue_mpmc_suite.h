@@ -0,0 +1,206 @@
+#ifndef QUEUE_MPMC_SUITE_INCLUDED
+#define QUEUE_MPMC_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "greatest.h"
+#include "queue_test_helper.h"
+#include "queue_mpmc.h"
+
+/* Declare a local suite. */
+SUITE(Queue_Mpmc_Suite);
+
+#define QUEUE_MPMC_THREADS                  (3u)
+#define QUEUE_MPMC_ELEMENTS_PER_PRODUCER    (50000u)
+
+typedef struct _Queue_Mpmc_Worker_t
+{
+    QueueMpmc_t *pQ;
+    atomic_uint *pRemaining;
+    uint64_t     sum;
+} Queue_Mpmc_Worker_t;
+
+static void *Queue_Mpmc_Producer(void *pArg)
+{
+    Queue_Mpmc_Worker_t *pWorker = pArg;
+
+    for (uint32_t i = 1; i <= QUEUE_MPMC_ELEMENTS_PER_PRODUCER; i++)
+    {
+        uint32_t dataIn = i;
+        while (QueueMpmc_Push(pWorker->pQ, &dataIn) != Queue_Error_None)
+        {
+            sched_yield(); /* Wait for a consumer to free a cell */
+        }
+        pWorker->sum += dataIn;
+    }
+
+    return NULL;
+}
+
+static void *Queue_Mpmc_Consumer(void *pArg)
+{
+    Queue_Mpmc_Worker_t *pWorker = pArg;
+    uint32_t dataOut;
+
+    while (atomic_load(pWorker->pRemaining) > 0)
+    {
+        if (QueueMpmc_Pop(pWorker->pQ, &dataOut) == Queue_Error_None)
+        {
+            pWorker->sum += dataOut;
+            atomic_fetch_sub(pWorker->pRemaining, 1);
+        }
+        else
+        {
+            sched_yield(); /* Wait for a producer to publish a cell */
+        }
+    }
+
+    return NULL;
+}
+
+TEST Queue_mpmc_init_fails_if_cell_count_is_not_a_power_of_two(void)
+{
+    /*****************    Arrange    *****************/
+    QueueMpmc_t q;
+    _Alignas(size_t) uint8_t buf[QUEUE_MPMC_BUF_SIZE(3, sizeof(uint32_t))];
+
+    /*****************     Act       *****************/
+    Queue_Error_e err = QueueMpmc_Init(&q, buf, sizeof(buf), sizeof(uint32_t));
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, err);
+
+    PASS();
+}
+
+TEST Queue_mpmc_can_report_empty_and_full(void)
+{
+    /*****************    Arrange    *****************/
+    QueueMpmc_t q;
+    _Alignas(size_t) uint8_t buf[QUEUE_MPMC_BUF_SIZE(2, sizeof(uint16_t))];
+    uint16_t dataIn = 5;
+    Queue_Error_e err = QueueMpmc_Init(&q, buf, sizeof(buf), sizeof(uint16_t));
+
+    /*****************     Act       *****************/
+    bool wasEmpty = QueueMpmc_IsEmpty(&q);
+    QueueMpmc_Push(&q, &dataIn);
+    QueueMpmc_Push(&q, &dataIn);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error_None, err);
+    ASSERT_EQ(true, wasEmpty);
+    ASSERT_EQ(false, QueueMpmc_IsEmpty(&q));
+    ASSERT_EQ(true, QueueMpmc_IsFull(&q));
+
+    PASS();
+}
+
+TEST Queue_mpmc_push_fails_if_overflow_and_pop_fails_if_underflow(void)
+{
+    /*****************    Arrange    *****************/
+    QueueMpmc_t q;
+    _Alignas(size_t) uint8_t buf[QUEUE_MPMC_BUF_SIZE(2, sizeof(uint8_t))];
+    uint8_t dataIn = 5;
+    uint8_t dataOut;
+    QueueMpmc_Init(&q, buf, sizeof(buf), sizeof(uint8_t));
+
+    /*****************     Act       *****************/
+    Queue_Error_e popErr = QueueMpmc_Pop(&q, &dataOut);
+    QueueMpmc_Push(&q, &dataIn);
+    QueueMpmc_Push(&q, &dataIn);
+    Queue_Error_e pushErr = QueueMpmc_Push(&q, &dataIn);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, popErr);
+    ASSERT_EQ(Queue_Error, pushErr);
+
+    PASS();
+}
+
+TEST Queue_mpmc_can_peek_and_pop_in_order_across_the_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    QueueMpmc_t q;
+    _Alignas(size_t) uint8_t buf[QUEUE_MPMC_BUF_SIZE(4, sizeof(uint64_t))];
+    uint64_t peekData;
+    uint64_t dataOut;
+    uint8_t err = (uint8_t)Queue_Error_None;
+    QueueMpmc_Init(&q, buf, sizeof(buf), sizeof(uint64_t));
+
+    /*****************     Act       *****************/
+    for (uint64_t i = 0; i < 100; i++)
+    {
+        uint64_t next = i + 1;
+        err |= QueueMpmc_Push(&q, &i);
+        err |= QueueMpmc_Push(&q, &next);
+        err |= QueueMpmc_Peek(&q, &peekData);
+        err |= QueueMpmc_Pop(&q, &dataOut);
+
+        /*****************    Assert     *****************/
+        ASSERT_EQ(Queue_Error_None, (Queue_Error_e)err);
+        ASSERT_EQ(i, peekData);
+        ASSERT_EQ(i, dataOut);
+
+        err |= QueueMpmc_Pop(&q, &dataOut);
+        ASSERT_EQ(next, dataOut);
+        ASSERT_EQ(true, QueueMpmc_IsEmpty(&q));
+    }
+
+    PASS();
+}
+
+TEST Queue_mpmc_can_be_shared_by_several_producers_and_consumers(void)
+{
+    /*****************    Arrange    *****************/
+    QueueMpmc_t q;
+    _Alignas(size_t) uint8_t buf[QUEUE_MPMC_BUF_SIZE(64, sizeof(uint32_t))];
+    atomic_uint remaining = QUEUE_MPMC_THREADS * QUEUE_MPMC_ELEMENTS_PER_PRODUCER;
+    Queue_Mpmc_Worker_t producers[QUEUE_MPMC_THREADS] = { 0 };
+    Queue_Mpmc_Worker_t consumers[QUEUE_MPMC_THREADS] = { 0 };
+    pthread_t threads[2 * QUEUE_MPMC_THREADS];
+    uint64_t pushed = 0;
+    uint64_t popped = 0;
+    QueueMpmc_Init(&q, buf, sizeof(buf), sizeof(uint32_t));
+
+    /*****************     Act       *****************/
+    for (uint32_t i = 0; i < QUEUE_MPMC_THREADS; i++)
+    {
+        producers[i] = (Queue_Mpmc_Worker_t){ .pQ = &q };
+        consumers[i] = (Queue_Mpmc_Worker_t){ .pQ = &q, .pRemaining = &remaining };
+        pthread_create(&threads[i], NULL, Queue_Mpmc_Producer, &producers[i]);
+        pthread_create(&threads[QUEUE_MPMC_THREADS + i], NULL, Queue_Mpmc_Consumer, &consumers[i]);
+    }
+    for (uint32_t i = 0; i < ELEMENTS_IN(threads); i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    for (uint32_t i = 0; i < QUEUE_MPMC_THREADS; i++)
+    {
+        pushed += producers[i].sum;
+        popped += consumers[i].sum;
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(pushed, popped);
+    ASSERT_EQ(true, QueueMpmc_IsEmpty(&q));
+
+    PASS();
+}
+
+SUITE(Queue_Mpmc_Suite)
+{
+    /* Unit Tests */
+    RUN_TEST(Queue_mpmc_init_fails_if_cell_count_is_not_a_power_of_two);
+    RUN_TEST(Queue_mpmc_can_report_empty_and_full);
+    RUN_TEST(Queue_mpmc_push_fails_if_overflow_and_pop_fails_if_underflow);
+    RUN_TEST(Queue_mpmc_can_peek_and_pop_in_order_across_the_wrap);
+
+    /* Integration Tests */
+    RUN_TEST(Queue_mpmc_can_be_shared_by_several_producers_and_consumers);
+}
+
+#endif /* QUEUE_MPMC_SUITE_INCLUDED */
@@ -0,0 +1,193 @@
+#ifndef QUEUE_MPSC_SUITE_INCLUDED
+#define QUEUE_MPSC_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "greatest.h"
+#include "queue_test_helper.h"
+#include "queue_mpsc.h"
+
+/* Declare a local suite. */
+SUITE(Queue_Mpsc_Suite);
+
+#define QUEUE_MPSC_PRODUCERS                (4u)
+#define QUEUE_MPSC_ELEMENTS_PER_PRODUCER    (50000u)
+
+typedef struct _Queue_Mpsc_Producer_t
+{
+    QueueMpsc_t *pQ;
+    uint32_t     id;
+} Queue_Mpsc_Producer_t;
+
+static void *Queue_Mpsc_Producer(void *pArg)
+{
+    Queue_Mpsc_Producer_t *pProducer = pArg;
+
+    for (uint32_t i = 0; i < QUEUE_MPSC_ELEMENTS_PER_PRODUCER; i++)
+    {
+        /* Tag each element with its producer so ordering can be checked */
+        uint32_t dataIn = (pProducer->id << 24) | i;
+        while (QueueMpsc_Push(pProducer->pQ, &dataIn) != Queue_Error_None)
+        {
+            sched_yield(); /* Wait for the consumer to drain */
+        }
+    }
+
+    return NULL;
+}
+
+TEST Queue_mpsc_init_fails_if_cell_count_is_not_a_power_of_two(void)
+{
+    /*****************    Arrange    *****************/
+    QueueMpsc_t q;
+    _Alignas(size_t) uint8_t buf[QUEUE_MPSC_BUF_SIZE(6, sizeof(uint32_t))];
+
+    /*****************     Act       *****************/
+    Queue_Error_e err = QueueMpsc_Init(&q, buf, sizeof(buf), sizeof(uint32_t));
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, err);
+
+    PASS();
+}
+
+TEST Queue_mpsc_push_fails_if_overflow_and_pop_fails_if_underflow(void)
+{
+    /*****************    Arrange    *****************/
+    QueueMpsc_t q;
+    _Alignas(size_t) uint8_t buf[QUEUE_MPSC_BUF_SIZE(2, sizeof(uint8_t))];
+    uint8_t dataIn = 5;
+    uint8_t dataOut;
+    QueueMpsc_Init(&q, buf, sizeof(buf), sizeof(uint8_t));
+
+    /*****************     Act       *****************/
+    Queue_Error_e popErr = QueueMpsc_Pop(&q, &dataOut);
+    QueueMpsc_Push(&q, &dataIn);
+    QueueMpsc_Push(&q, &dataIn);
+    Queue_Error_e pushErr = QueueMpsc_Push(&q, &dataIn);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, popErr);
+    ASSERT_EQ(Queue_Error, pushErr);
+    ASSERT_EQ(true, QueueMpsc_IsFull(&q));
+
+    PASS();
+}
+
+TEST Queue_mpsc_can_peek_and_pop_in_order(void)
+{
+    /*****************    Arrange    *****************/
+    QueueMpsc_t q;
+    _Alignas(size_t) uint8_t buf[QUEUE_MPSC_BUF_SIZE(4, sizeof(uint16_t))];
+    uint16_t dataIn[] = { 301, 244 };
+    uint16_t peekData;
+    uint16_t dataOut[2];
+    QueueMpsc_Init(&q, buf, sizeof(buf), sizeof(uint16_t));
+    QueueMpsc_Push(&q, &dataIn[0]);
+    QueueMpsc_Push(&q, &dataIn[1]);
+
+    /*****************     Act       *****************/
+    Queue_Error_e err = QueueMpsc_Peek(&q, &peekData);
+    QueueMpsc_Pop(&q, &dataOut[0]);
+    QueueMpsc_Pop(&q, &dataOut[1]);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error_None, err);
+    ASSERT_EQ(dataIn[0], peekData);
+    ASSERT_MEM_EQ(dataIn, dataOut, sizeof(dataIn));
+    ASSERT_EQ(true, QueueMpsc_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Queue_mpsc_pop_all_returns_every_committed_element(void)
+{
+    /*****************    Arrange    *****************/
+    QueueMpsc_t q;
+    _Alignas(size_t) uint8_t buf[QUEUE_MPSC_BUF_SIZE(8, sizeof(uint32_t))];
+    uint32_t dataOut[8] = { 0 };
+    uint32_t expected[8] = { 0 };
+    size_t popped = 0;
+    QueueMpsc_Init(&q, buf, sizeof(buf), sizeof(uint32_t));
+
+    /*****************     Act       *****************/
+    for (uint32_t lap = 0; lap < 3; lap++)
+    {
+        for (uint32_t i = 0; i < 5; i++)
+        {
+            expected[i] = lap * 100 + i;
+            QueueMpsc_Push(&q, &expected[i]);
+        }
+        popped = QueueMpsc_PopAll(&q, dataOut, ELEMENTS_IN(dataOut));
+
+        /*****************    Assert     *****************/
+        ASSERT_EQ(5, popped);
+        ASSERT_MEM_EQ(expected, dataOut, 5 * sizeof(uint32_t));
+        ASSERT_EQ(true, QueueMpsc_IsEmpty(&q));
+    }
+
+    PASS();
+}
+
+TEST Queue_mpsc_preserves_per_producer_order_across_threads(void)
+{
+    /*****************    Arrange    *****************/
+    QueueMpsc_t q;
+    _Alignas(size_t) uint8_t buf[QUEUE_MPSC_BUF_SIZE(64, sizeof(uint32_t))];
+    Queue_Mpsc_Producer_t producers[QUEUE_MPSC_PRODUCERS];
+    pthread_t threads[QUEUE_MPSC_PRODUCERS];
+    uint32_t next[QUEUE_MPSC_PRODUCERS] = { 0 };
+    uint32_t batch[16];
+    uint32_t received = 0;
+    uint32_t mismatches = 0;
+    QueueMpsc_Init(&q, buf, sizeof(buf), sizeof(uint32_t));
+
+    /*****************     Act       *****************/
+    for (uint32_t i = 0; i < QUEUE_MPSC_PRODUCERS; i++)
+    {
+        producers[i] = (Queue_Mpsc_Producer_t){ .pQ = &q, .id = i };
+        pthread_create(&threads[i], NULL, Queue_Mpsc_Producer, &producers[i]);
+    }
+    while (received < QUEUE_MPSC_PRODUCERS * QUEUE_MPSC_ELEMENTS_PER_PRODUCER)
+    {
+        size_t popped = QueueMpsc_PopAll(&q, batch, ELEMENTS_IN(batch));
+        for (size_t i = 0; i < popped; i++)
+        {
+            uint32_t id = batch[i] >> 24;
+            mismatches += ((batch[i] & 0xFFFFFF) != next[id]++);
+        }
+        received += popped;
+        if (popped == 0)
+        {
+            sched_yield(); /* Wait for the producers to commit */
+        }
+    }
+    for (uint32_t i = 0; i < QUEUE_MPSC_PRODUCERS; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(0, mismatches);
+    ASSERT_EQ(true, QueueMpsc_IsEmpty(&q));
+
+    PASS();
+}
+
+SUITE(Queue_Mpsc_Suite)
+{
+    /* Unit Tests */
+    RUN_TEST(Queue_mpsc_init_fails_if_cell_count_is_not_a_power_of_two);
+    RUN_TEST(Queue_mpsc_push_fails_if_overflow_and_pop_fails_if_underflow);
+    RUN_TEST(Queue_mpsc_can_peek_and_pop_in_order);
+    RUN_TEST(Queue_mpsc_pop_all_returns_every_committed_element);
+
+    /* Integration Tests */
+    RUN_TEST(Queue_mpsc_preserves_per_producer_order_across_threads);
+}
+
+#endif /* QUEUE_MPSC_SUITE_INCLUDED */
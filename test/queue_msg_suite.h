@@ -0,0 +1,187 @@
+#ifndef QUEUE_MSG_SUITE_INCLUDED
+#define QUEUE_MSG_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "greatest.h"
+#include "queue_test_helper.h"
+#include "queue_msg.h"
+
+/* Declare a local suite. */
+SUITE(Queue_Msg_Suite);
+
+TEST Queue_msg_init_fails_if_buffer_is_not_aligned_to_records(void)
+{
+    /*****************    Arrange    *****************/
+    QueueMsg_t q;
+    uint32_t buf[4];
+
+    /*****************     Act       *****************/
+    Queue_Error_e err = QueueMsg_Init(&q, buf, sizeof(buf) - 1);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, err);
+
+    PASS();
+}
+
+TEST Queue_msg_can_push_and_pop_messages_of_different_lengths(void)
+{
+    /*****************    Arrange    *****************/
+    QueueMsg_t q;
+    uint32_t buf[16];
+    char dataOut[32];
+    size_t len = 0;
+    QueueMsg_Init(&q, buf, sizeof(buf));
+
+    /*****************     Act       *****************/
+    QueueMsg_PushBytes(&q, "a", 1);
+    QueueMsg_PushBytes(&q, "", 0);
+    QueueMsg_PushBytes(&q, "hello queue", 11);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(3, QueueMsg_Count(&q));
+    ASSERT_EQ(Queue_Error_None, QueueMsg_PopBytes(&q, dataOut, sizeof(dataOut), &len));
+    ASSERT_EQ(1, len);
+    ASSERT_MEM_EQ("a", dataOut, 1);
+    ASSERT_EQ(Queue_Error_None, QueueMsg_PopBytes(&q, dataOut, sizeof(dataOut), &len));
+    ASSERT_EQ(0, len);
+    ASSERT_EQ(Queue_Error_None, QueueMsg_PopBytes(&q, dataOut, sizeof(dataOut), &len));
+    ASSERT_EQ(11, len);
+    ASSERT_MEM_EQ("hello queue", dataOut, 11);
+    ASSERT_EQ(true, QueueMsg_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Queue_msg_push_fails_if_there_is_no_room(void)
+{
+    /*****************    Arrange    *****************/
+    QueueMsg_t q;
+    uint32_t buf[4];
+    uint8_t dataIn[12] = { 0 };
+    QueueMsg_Init(&q, buf, sizeof(buf));
+
+    /*****************     Act       *****************/
+    Queue_Error_e tooBigErr = QueueMsg_PushBytes(&q, dataIn, 13);
+    Queue_Error_e fitErr = QueueMsg_PushBytes(&q, dataIn, 12);
+    Queue_Error_e fullErr = QueueMsg_PushBytes(&q, dataIn, 0);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, tooBigErr);
+    ASSERT_EQ(Queue_Error_None, fitErr);
+    ASSERT_EQ(Queue_Error, fullErr);
+
+    PASS();
+}
+
+TEST Queue_msg_pop_keeps_messages_that_do_not_fit_the_caller_buffer(void)
+{
+    /*****************    Arrange    *****************/
+    QueueMsg_t q;
+    uint32_t buf[8];
+    char dataOut[4];
+    size_t len = 0;
+    QueueMsg_Init(&q, buf, sizeof(buf));
+    QueueMsg_PushBytes(&q, "too long", 8);
+
+    /*****************     Act       *****************/
+    Queue_Error_e err = QueueMsg_PopBytes(&q, dataOut, sizeof(dataOut), &len);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, err);
+    ASSERT_EQ(8, len);
+    ASSERT_EQ(1, QueueMsg_Count(&q));
+    ASSERT_EQ(Queue_Error_None, QueueMsg_PopBytes(&q, NULL, 0, NULL));
+    ASSERT_EQ(true, QueueMsg_IsEmpty(&q));
+    ASSERT_EQ(Queue_Error, QueueMsg_PopBytes(&q, NULL, 0, NULL));
+
+    PASS();
+}
+
+TEST Queue_msg_peek_returns_contiguous_messages_across_the_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    QueueMsg_t q;
+    uint32_t buf[8];
+    const void *pData = NULL;
+    size_t len = 0;
+    QueueMsg_Init(&q, buf, sizeof(buf));
+    QueueMsg_PushBytes(&q, "0123456789", 10);
+    QueueMsg_PushBytes(&q, "abcdefgh", 8);
+    QueueMsg_PopBytes(&q, NULL, 0, NULL);
+
+    /*****************     Act       *****************/
+    /* Only 4 bytes remain at the tail, so this record must wrap to the top */
+    Queue_Error_e pushErr = QueueMsg_PushBytes(&q, "wrapped!", 8);
+    QueueMsg_PopBytes(&q, NULL, 0, NULL);
+    Queue_Error_e peekErr = QueueMsg_PeekBytes(&q, &pData, &len);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error_None, pushErr);
+    ASSERT_EQ(Queue_Error_None, peekErr);
+    ASSERT_EQ(8, len);
+    ASSERT_EQ((const void *)((uint8_t *)buf + sizeof(uint32_t)), pData);
+    ASSERT_MEM_EQ("wrapped!", pData, 8);
+
+    PASS();
+}
+
+TEST Queue_msg_can_cycle_random_lengths_through_a_small_buffer(void)
+{
+    /*****************    Arrange    *****************/
+    QueueMsg_t q;
+    uint32_t buf[64];
+    uint8_t dataIn[100];
+    uint8_t dataOut[100];
+    size_t pushedLen[64];
+    size_t pushed = 0;
+    size_t popped = 0;
+    uint32_t seed = 1;
+    QueueMsg_Init(&q, buf, sizeof(buf));
+
+    /*****************     Act       *****************/
+    for (uint32_t i = 0; i < 20000; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        size_t len = (seed >> 16) % ELEMENTS_IN(dataIn);
+        memset(dataIn, (int)(pushed & 0xFF), len);
+
+        if ((seed & 0x100) && QueueMsg_PushBytes(&q, dataIn, len) == Queue_Error_None)
+        {
+            pushedLen[pushed++ % ELEMENTS_IN(pushedLen)] = len;
+        }
+        else if (!QueueMsg_IsEmpty(&q))
+        {
+            size_t outLen = 0;
+            uint8_t expected[100];
+            QueueMsg_PopBytes(&q, dataOut, sizeof(dataOut), &outLen);
+            memset(expected, (int)(popped & 0xFF), outLen);
+
+            /*****************    Assert     *****************/
+            ASSERT_EQ(pushedLen[popped++ % ELEMENTS_IN(pushedLen)], outLen);
+            ASSERT_MEM_EQ(expected, dataOut, outLen);
+        }
+        ASSERT_EQ(pushed - popped, QueueMsg_Count(&q));
+    }
+
+    PASS();
+}
+
+SUITE(Queue_Msg_Suite)
+{
+    /* Unit Tests */
+    RUN_TEST(Queue_msg_init_fails_if_buffer_is_not_aligned_to_records);
+    RUN_TEST(Queue_msg_can_push_and_pop_messages_of_different_lengths);
+    RUN_TEST(Queue_msg_push_fails_if_there_is_no_room);
+    RUN_TEST(Queue_msg_pop_keeps_messages_that_do_not_fit_the_caller_buffer);
+    RUN_TEST(Queue_msg_peek_returns_contiguous_messages_across_the_wrap);
+
+    /* Integration Tests */
+    RUN_TEST(Queue_msg_can_cycle_random_lengths_through_a_small_buffer);
+}
+
+#endif /* QUEUE_MSG_SUITE_INCLUDED */
@@ -0,0 +1,122 @@
+#ifndef QUEUE_POW2_SUITE_INCLUDED
+#define QUEUE_POW2_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "greatest.h"
+#include "queue_test_helper.h"
+#include "queue_pow2.h"
+
+/* Declare a local suite. */
+SUITE(Queue_Pow2_Suite);
+
+TEST Queue_pow2_init_fails_if_capacity_is_not_a_power_of_two(void)
+{
+    /*****************    Arrange    *****************/
+    QueuePow2_t q;
+    uint32_t buf[6];
+
+    /*****************     Act       *****************/
+    Queue_Error_e err = QueuePow2_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, err);
+
+    PASS();
+}
+
+TEST Queue_pow2_can_report_empty_full_and_count(void)
+{
+    /*****************    Arrange    *****************/
+    QueuePow2_t q;
+    uint8_t buf[4];
+    uint8_t dataIn = 5;
+    Queue_Error_e err = QueuePow2_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    bool wasEmpty = QueuePow2_IsEmpty(&q);
+    QueuePow2_Push(&q, &dataIn);
+    QueuePow2_Push(&q, &dataIn);
+    size_t partial = QueuePow2_Count(&q);
+    QueuePow2_Push(&q, &dataIn);
+    QueuePow2_Push(&q, &dataIn);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error_None, err);
+    ASSERT_EQ(true, wasEmpty);
+    ASSERT_EQ(2, partial);
+    ASSERT_EQ(4, QueuePow2_Count(&q));
+    ASSERT_EQ(true, QueuePow2_IsFull(&q));
+    ASSERT_EQ(false, QueuePow2_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Queue_pow2_push_fails_if_overflow_and_pop_fails_if_underflow(void)
+{
+    /*****************    Arrange    *****************/
+    QueuePow2_t q;
+    uint16_t buf[2];
+    uint16_t dataIn = 5;
+    uint16_t dataOut;
+    QueuePow2_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    Queue_Error_e popErr = QueuePow2_Pop(&q, &dataOut);
+    QueuePow2_Push(&q, &dataIn);
+    QueuePow2_Push(&q, &dataIn);
+    Queue_Error_e pushErr = QueuePow2_Push(&q, &dataIn);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, popErr);
+    ASSERT_EQ(Queue_Error, pushErr);
+
+    PASS();
+}
+
+TEST Queue_pow2_can_partially_fill_and_empty_multiple_times(void)
+{
+    /*****************    Arrange    *****************/
+    QueuePow2_t q;
+    int64_t buf[8];
+    int64_t peekData;
+    int64_t dataOut[3];
+    uint8_t err = (uint8_t)Queue_Error_None;
+    QueuePow2_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    for (int64_t i = 0; i < 100000; i++)
+    {
+        int64_t dataIn[3] = { i, -i, INT64_MAX - i };
+        err |= QueuePow2_Push(&q, &dataIn[0]);
+        err |= QueuePow2_Push(&q, &dataIn[1]);
+        err |= QueuePow2_Push(&q, &dataIn[2]);
+        err |= QueuePow2_Peek(&q, &peekData);
+        err |= QueuePow2_Pop(&q, &dataOut[0]);
+        err |= QueuePow2_Pop(&q, &dataOut[1]);
+        err |= QueuePow2_Pop(&q, &dataOut[2]);
+
+        /*****************    Assert     *****************/
+        ASSERT_EQ(Queue_Error_None, (Queue_Error_e)err);
+        ASSERT_EQ(i, peekData);
+        ASSERT_MEM_EQ(dataIn, dataOut, sizeof(dataIn));
+        ASSERT_EQ(true, QueuePow2_IsEmpty(&q));
+    }
+
+    PASS();
+}
+
+SUITE(Queue_Pow2_Suite)
+{
+    /* Unit Tests */
+    RUN_TEST(Queue_pow2_init_fails_if_capacity_is_not_a_power_of_two);
+    RUN_TEST(Queue_pow2_can_report_empty_full_and_count);
+    RUN_TEST(Queue_pow2_push_fails_if_overflow_and_pop_fails_if_underflow);
+
+    /* Integration Tests */
+    RUN_TEST(Queue_pow2_can_partially_fill_and_empty_multiple_times);
+}
+
+#endif /* QUEUE_POW2_SUITE_INCLUDED */
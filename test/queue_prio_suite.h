@@ -0,0 +1,161 @@
+#ifndef QUEUE_PRIO_SUITE_INCLUDED
+#define QUEUE_PRIO_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "greatest.h"
+#include "queue_test_helper.h"
+#include "queue_prio.h"
+
+/* Declare a local suite. */
+SUITE(Queue_Prio_Suite);
+
+typedef struct _Queue_Prio_Job_t
+{
+    int64_t  deadline;
+    uint32_t id;
+    uint32_t level;
+} Queue_Prio_Job_t;
+
+/* Highest level first */
+static int Queue_Prio_CompareLevel(const void *pA, const void *pB)
+{
+    const Queue_Prio_Job_t *pJobA = pA;
+    const Queue_Prio_Job_t *pJobB = pB;
+
+    return (pJobA->level > pJobB->level) ? -1 : (pJobA->level < pJobB->level);
+}
+
+TEST Queue_prio_init_key_fails_if_key_is_outside_the_element(void)
+{
+    /*****************    Arrange    *****************/
+    QueuePrio_t q;
+    Queue_Prio_Job_t buf[4];
+
+    /*****************     Act       *****************/
+    Queue_Error_e err = QueuePrio_InitKey(&q, buf, sizeof(buf), sizeof(buf[0]),
+                                          sizeof(buf[0]) - sizeof(int64_t) + 1);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, err);
+
+    PASS();
+}
+
+TEST Queue_prio_push_fails_if_overflow_and_pop_fails_if_underflow(void)
+{
+    /*****************    Arrange    *****************/
+    QueuePrio_t q;
+    Queue_Prio_Job_t buf[2];
+    Queue_Prio_Job_t job = { .deadline = 1 };
+    QueuePrio_InitKey(&q, buf, sizeof(buf), sizeof(buf[0]), offsetof(Queue_Prio_Job_t, deadline));
+
+    /*****************     Act       *****************/
+    Queue_Error_e popErr = QueuePrio_Pop(&q, &job);
+    QueuePrio_Push(&q, &job);
+    QueuePrio_Push(&q, &job);
+    Queue_Error_e pushErr = QueuePrio_Push(&q, &job);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, popErr);
+    ASSERT_EQ(Queue_Error, pushErr);
+    ASSERT_EQ(true, QueuePrio_IsFull(&q));
+    ASSERT_EQ(2, QueuePrio_Count(&q));
+
+    PASS();
+}
+
+TEST Queue_prio_pops_highest_priority_first_with_a_comparator(void)
+{
+    /*****************    Arrange    *****************/
+    QueuePrio_t q;
+    Queue_Prio_Job_t buf[8];
+    uint32_t levels[] = { 2, 7, 1, 9, 4, 7, 3, 0 };
+    Queue_Prio_Job_t peekData;
+    Queue_Prio_Job_t dataOut;
+    uint32_t popped[8];
+    QueuePrio_Init(&q, buf, sizeof(buf), sizeof(buf[0]), Queue_Prio_CompareLevel);
+    for (uint32_t i = 0; i < ELEMENTS_IN(levels); i++)
+    {
+        Queue_Prio_Job_t job = { .id = i, .level = levels[i] };
+        QueuePrio_Push(&q, &job);
+    }
+
+    /*****************     Act       *****************/
+    Queue_Error_e err = QueuePrio_Peek(&q, &peekData);
+    for (uint32_t i = 0; i < ELEMENTS_IN(popped); i++)
+    {
+        QueuePrio_Pop(&q, &dataOut);
+        popped[i] = dataOut.level;
+    }
+
+    /*****************    Assert     *****************/
+    uint32_t expected[] = { 9, 7, 7, 4, 3, 2, 1, 0 };
+    ASSERT_EQ(Queue_Error_None, err);
+    ASSERT_EQ(3, peekData.id);
+    ASSERT_MEM_EQ(expected, popped, sizeof(expected));
+    ASSERT_EQ(true, QueuePrio_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Queue_prio_key_order_holds_under_interleaved_pushes_and_pops(void)
+{
+    /*****************    Arrange    *****************/
+    QueuePrio_t q;
+    static Queue_Prio_Job_t buf[1000];
+    Queue_Prio_Job_t dataOut;
+    int64_t last = INT64_MIN;
+    uint32_t outOfOrder = 0;
+    uint32_t pushed = 0;
+    uint32_t popped = 0;
+    QueuePrio_InitKey(&q, buf, sizeof(buf), sizeof(buf[0]), offsetof(Queue_Prio_Job_t, deadline));
+    srand(1234);
+
+    /*****************     Act       *****************/
+    /* Keys only ever grow past what has been popped, like timer deadlines */
+    for (uint32_t i = 0; i < 20000; i++)
+    {
+        if (!QueuePrio_IsFull(&q) && (rand() % 3 != 0 || QueuePrio_IsEmpty(&q)))
+        {
+            Queue_Prio_Job_t job = { .deadline = (last == INT64_MIN ? 0 : last) + rand() % 5000, .id = i };
+            QueuePrio_Push(&q, &job);
+            pushed++;
+        }
+        else
+        {
+            QueuePrio_Pop(&q, &dataOut);
+            outOfOrder += (dataOut.deadline < last);
+            last = dataOut.deadline;
+            popped++;
+        }
+    }
+    while (QueuePrio_Pop(&q, &dataOut) == Queue_Error_None)
+    {
+        outOfOrder += (dataOut.deadline < last);
+        last = dataOut.deadline;
+        popped++;
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(0, outOfOrder);
+    ASSERT_EQ(pushed, popped);
+
+    PASS();
+}
+
+SUITE(Queue_Prio_Suite)
+{
+    /* Unit Tests */
+    RUN_TEST(Queue_prio_init_key_fails_if_key_is_outside_the_element);
+    RUN_TEST(Queue_prio_push_fails_if_overflow_and_pop_fails_if_underflow);
+    RUN_TEST(Queue_prio_pops_highest_priority_first_with_a_comparator);
+
+    /* Integration Tests */
+    RUN_TEST(Queue_prio_key_order_holds_under_interleaved_pushes_and_pops);
+}
+
+#endif /* QUEUE_PRIO_SUITE_INCLUDED */
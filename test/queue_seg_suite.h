@@ -0,0 +1,203 @@
+#ifndef QUEUE_SEG_SUITE_INCLUDED
+#define QUEUE_SEG_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "greatest.h"
+#include "queue_test_helper.h"
+#include "queue_seg.h"
+
+/* Declare a local suite. */
+SUITE(Queue_Seg_Suite);
+
+typedef struct _Queue_Seg_Counter_t
+{
+    uint32_t allocs;
+    uint32_t frees;
+    bool     fail;
+} Queue_Seg_Counter_t;
+
+static void *Queue_Seg_CounterAlloc(void *pCtx, size_t size)
+{
+    Queue_Seg_Counter_t *pCounter = pCtx;
+    if (pCounter->fail)
+    {
+        return NULL;
+    }
+    pCounter->allocs++;
+    return malloc(size);
+}
+
+static void Queue_Seg_CounterFree(void *pCtx, void *pMem, size_t size)
+{
+    Queue_Seg_Counter_t *pCounter = pCtx;
+    (void)size;
+    pCounter->frees++;
+    free(pMem);
+}
+
+#define QUEUE_SEG_COUNTING_ALLOCATOR(counter)     \
+    {                                             \
+        .pfnAlloc = Queue_Seg_CounterAlloc,       \
+        .pfnRealloc = NULL,                       \
+        .pfnFree = Queue_Seg_CounterFree,         \
+        .pCtx = &(counter),                       \
+    }
+
+TEST Queue_seg_init_fails_if_segment_is_empty(void)
+{
+    /*****************    Arrange    *****************/
+    QueueSeg_t q;
+
+    /*****************     Act       *****************/
+    Queue_Error_e err = QueueSeg_Init(&q, NULL, 0, sizeof(uint32_t), 1);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, err);
+
+    PASS();
+}
+
+TEST Queue_seg_keeps_order_across_many_segments(void)
+{
+    /*****************    Arrange    *****************/
+    QueueSeg_t q;
+    uint32_t dataOut;
+    uint32_t peekData;
+    uint32_t next = 0;
+    uint32_t mismatches = 0;
+    QueueSeg_Init(&q, NULL, 4, sizeof(uint32_t), 2);
+
+    /*****************     Act       *****************/
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        ASSERT_EQ(Queue_Error_None, QueueSeg_Push(&q, &i));
+    }
+    size_t count = QueueSeg_Count(&q);
+    QueueSeg_Peek(&q, &peekData);
+    while (QueueSeg_Pop(&q, &dataOut) == Queue_Error_None)
+    {
+        mismatches += (dataOut != next++);
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(1000, count);
+    ASSERT_EQ(0, peekData);
+    ASSERT_EQ(0, mismatches);
+    ASSERT_EQ(1000, next);
+    ASSERT_EQ(true, QueueSeg_IsEmpty(&q));
+    ASSERT_EQ(Queue_Error, QueueSeg_Peek(&q, &peekData));
+
+    QueueSeg_Deinit(&q);
+    PASS();
+}
+
+TEST Queue_seg_reuses_pooled_segments_without_allocating(void)
+{
+    /*****************    Arrange    *****************/
+    QueueSeg_t q;
+    Queue_Seg_Counter_t counter = { 0 };
+    Queue_Allocator_t allocator = QUEUE_SEG_COUNTING_ALLOCATOR(counter);
+    uint16_t dataOut;
+    QueueSeg_Init(&q, &allocator, 8, sizeof(uint16_t), 4);
+
+    /* Warm up: a 32 element burst needs 4 segments */
+    for (uint16_t i = 0; i < 32; i++)
+    {
+        QueueSeg_Push(&q, &i);
+    }
+    while (QueueSeg_Pop(&q, &dataOut) == Queue_Error_None)
+    {
+    }
+    uint32_t allocsAfterWarmup = counter.allocs;
+
+    /*****************     Act       *****************/
+    for (uint32_t lap = 0; lap < 100; lap++)
+    {
+        for (uint16_t i = 0; i < 32; i++)
+        {
+            QueueSeg_Push(&q, &i);
+        }
+        while (QueueSeg_Pop(&q, &dataOut) == Queue_Error_None)
+        {
+        }
+    }
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(4, allocsAfterWarmup);
+    ASSERT_EQ(4, counter.allocs);
+    ASSERT_EQ(0, counter.frees);
+    QueueSeg_Deinit(&q);
+    ASSERT_EQ(counter.allocs, counter.frees);
+
+    PASS();
+}
+
+TEST Queue_seg_releases_segments_beyond_the_pool_limit(void)
+{
+    /*****************    Arrange    *****************/
+    QueueSeg_t q;
+    Queue_Seg_Counter_t counter = { 0 };
+    Queue_Allocator_t allocator = QUEUE_SEG_COUNTING_ALLOCATOR(counter);
+    uint8_t dataOut;
+    QueueSeg_Init(&q, &allocator, 2, sizeof(uint8_t), 1);
+
+    /*****************     Act       *****************/
+    for (uint8_t i = 0; i < 10; i++)
+    {
+        QueueSeg_Push(&q, &i);
+    }
+    while (QueueSeg_Pop(&q, &dataOut) == Queue_Error_None)
+    {
+    }
+
+    /*****************    Assert     *****************/
+    /* 5 segments: the last stays linked, one is pooled, three are freed */
+    ASSERT_EQ(5, counter.allocs);
+    ASSERT_EQ(3, counter.frees);
+    QueueSeg_Deinit(&q);
+    ASSERT_EQ(counter.allocs, counter.frees);
+
+    PASS();
+}
+
+TEST Queue_seg_push_fails_if_allocator_fails(void)
+{
+    /*****************    Arrange    *****************/
+    QueueSeg_t q;
+    Queue_Seg_Counter_t counter = { 0 };
+    Queue_Allocator_t allocator = QUEUE_SEG_COUNTING_ALLOCATOR(counter);
+    uint8_t dataIn[] = { 11, 22, 33 };
+    uint8_t dataOut[2];
+    QueueSeg_Init(&q, &allocator, 2, sizeof(uint8_t), 0);
+    QueueSeg_Push(&q, &dataIn[0]);
+    QueueSeg_Push(&q, &dataIn[1]);
+
+    /*****************     Act       *****************/
+    counter.fail = true;
+    Queue_Error_e err = QueueSeg_Push(&q, &dataIn[2]);
+    QueueSeg_Pop(&q, &dataOut[0]);
+    QueueSeg_Pop(&q, &dataOut[1]);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, err);
+    ASSERT_MEM_EQ(dataIn, dataOut, sizeof(dataOut));
+    ASSERT_EQ(true, QueueSeg_IsEmpty(&q));
+
+    QueueSeg_Deinit(&q);
+    PASS();
+}
+
+SUITE(Queue_Seg_Suite)
+{
+    /* Unit Tests */
+    RUN_TEST(Queue_seg_init_fails_if_segment_is_empty);
+    RUN_TEST(Queue_seg_keeps_order_across_many_segments);
+    RUN_TEST(Queue_seg_reuses_pooled_segments_without_allocating);
+    RUN_TEST(Queue_seg_releases_segments_beyond_the_pool_limit);
+    RUN_TEST(Queue_seg_push_fails_if_allocator_fails);
+}
+
+#endif /* QUEUE_SEG_SUITE_INCLUDED */
@@ -0,0 +1,320 @@
+#ifndef QUEUE_SPSC_SUITE_INCLUDED
+#define QUEUE_SPSC_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#include "greatest.h"
+#include "queue_test_helper.h"
+#include "queue_spsc.h"
+
+/* Declare a local suite. */
+SUITE(Queue_Spsc_Suite);
+
+#define QUEUE_SPSC_THREADED_ELEMENTS    (100000u)
+
+static void *Queue_Spsc_Producer(void *pArg)
+{
+    QueueSpsc_t *pQ = pArg;
+
+    for (uint32_t i = 0; i < QUEUE_SPSC_THREADED_ELEMENTS; i++)
+    {
+        while (QueueSpsc_Push(pQ, &i) != Queue_Error_None)
+        {
+            sched_yield(); /* Wait for the consumer to free a slot */
+        }
+    }
+
+    return NULL;
+}
+
+static void *Queue_Spsc_Blocking_Producer(void *pArg)
+{
+    QueueSpsc_t *pQ = pArg;
+
+    for (uint32_t i = 0; i < QUEUE_SPSC_THREADED_ELEMENTS; i++)
+    {
+        QueueSpsc_PushWait(pQ, &i, NULL);
+    }
+
+    return NULL;
+}
+
+static void *Queue_Spsc_Delayed_Producer(void *pArg)
+{
+    QueueSpsc_t *pQ = pArg;
+    struct timespec delay = { .tv_sec = 0, .tv_nsec = 20000000 };
+    uint32_t dataIn = 42;
+
+    nanosleep(&delay, NULL);
+    QueueSpsc_Push(pQ, &dataIn);
+
+    return NULL;
+}
+
+static void *Queue_Spsc_Delayed_Consumer(void *pArg)
+{
+    QueueSpsc_t *pQ = pArg;
+    struct timespec delay = { .tv_sec = 0, .tv_nsec = 20000000 };
+    uint32_t dataOut;
+
+    nanosleep(&delay, NULL);
+    QueueSpsc_Pop(pQ, &dataOut);
+
+    return NULL;
+}
+
+TEST Queue_spsc_init_fails_if_buffer_is_not_an_integer_multiple_of_data_size(void)
+{
+    /*****************    Arrange    *****************/
+    QueueSpsc_t q;
+    uint8_t buf[6];
+
+    /*****************     Act       *****************/
+    Queue_Error_e err = QueueSpsc_Init(&q, buf, sizeof(buf), 4);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, err);
+
+    PASS();
+}
+
+TEST Queue_spsc_can_report_empty_and_full(void)
+{
+    /*****************    Arrange    *****************/
+    QueueSpsc_t q;
+    uint16_t buf[2];
+    uint16_t dataIn = 5;
+    QueueSpsc_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    bool wasEmpty = QueueSpsc_IsEmpty(&q);
+    QueueSpsc_Push(&q, &dataIn);
+    QueueSpsc_Push(&q, &dataIn);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(true, wasEmpty);
+    ASSERT_EQ(false, QueueSpsc_IsEmpty(&q));
+    ASSERT_EQ(true, QueueSpsc_IsFull(&q));
+
+    PASS();
+}
+
+TEST Queue_spsc_push_fails_if_overflow_and_pop_fails_if_underflow(void)
+{
+    /*****************    Arrange    *****************/
+    QueueSpsc_t q;
+    uint8_t buf[2];
+    uint8_t dataIn = 5;
+    uint8_t dataOut;
+    QueueSpsc_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    Queue_Error_e popErr = QueueSpsc_Pop(&q, &dataOut);
+    QueueSpsc_Push(&q, &dataIn);
+    QueueSpsc_Push(&q, &dataIn);
+    Queue_Error_e pushErr = QueueSpsc_Push(&q, &dataIn);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, popErr);
+    ASSERT_EQ(Queue_Error, pushErr);
+
+    PASS();
+}
+
+TEST Queue_spsc_can_peek_and_pop_in_order_across_the_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    QueueSpsc_t q;
+    uint64_t buf[3];
+    uint64_t peekData;
+    uint64_t dataOut;
+    uint8_t err = (uint8_t)Queue_Error_None;
+    QueueSpsc_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    for (uint64_t i = 0; i < 100; i++)
+    {
+        err |= QueueSpsc_Push(&q, &i);
+        err |= QueueSpsc_Peek(&q, &peekData);
+        err |= QueueSpsc_Pop(&q, &dataOut);
+
+        /*****************    Assert     *****************/
+        ASSERT_EQ(Queue_Error_None, (Queue_Error_e)err);
+        ASSERT_EQ(i, peekData);
+        ASSERT_EQ(i, dataOut);
+        ASSERT_EQ(true, QueueSpsc_IsEmpty(&q));
+    }
+
+    PASS();
+}
+
+TEST Queue_spsc_can_hand_off_between_a_producer_and_consumer_thread(void)
+{
+    /*****************    Arrange    *****************/
+    QueueSpsc_t q;
+    uint32_t buf[64];
+    pthread_t producer;
+    uint32_t mismatches = 0;
+    QueueSpsc_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    pthread_create(&producer, NULL, Queue_Spsc_Producer, &q);
+    for (uint32_t i = 0; i < QUEUE_SPSC_THREADED_ELEMENTS; i++)
+    {
+        uint32_t dataOut;
+        while (QueueSpsc_Pop(&q, &dataOut) != Queue_Error_None)
+        {
+            sched_yield(); /* Wait for the producer to publish an element */
+        }
+        mismatches += (dataOut != i);
+    }
+    pthread_join(producer, NULL);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(0, mismatches);
+    ASSERT_EQ(true, QueueSpsc_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Queue_spsc_pop_wait_times_out_on_an_empty_queue(void)
+{
+    /*****************    Arrange    *****************/
+    QueueSpsc_t q;
+    uint32_t buf[4];
+    uint32_t dataOut;
+    struct timespec timeout = { .tv_sec = 0, .tv_nsec = 10000000 };
+    struct timespec start;
+    QueueSpsc_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    Queue_Error_e err = QueueSpsc_PopWait(&q, &dataOut, &timeout);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, err);
+    ASSERT(Queue_ElapsedNs(&start) >= timeout.tv_nsec);
+
+    PASS();
+}
+
+TEST Queue_spsc_wait_with_a_past_deadline_behaves_like_a_try(void)
+{
+    /*****************    Arrange    *****************/
+    QueueSpsc_t q;
+    uint32_t buf[1];
+    uint32_t dataIn = 7;
+    uint32_t dataOut;
+    struct timespec deadline = { 0 };
+    QueueSpsc_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    Queue_Error_e popEmptyErr = QueueSpsc_PopWaitUntil(&q, &dataOut, &deadline);
+    Queue_Error_e pushErr = QueueSpsc_PushWaitUntil(&q, &dataIn, &deadline);
+    Queue_Error_e pushFullErr = QueueSpsc_PushWaitUntil(&q, &dataIn, &deadline);
+    Queue_Error_e popErr = QueueSpsc_PopWaitUntil(&q, &dataOut, &deadline);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, popEmptyErr);
+    ASSERT_EQ(Queue_Error_None, pushErr);
+    ASSERT_EQ(Queue_Error, pushFullErr);
+    ASSERT_EQ(Queue_Error_None, popErr);
+    ASSERT_EQ(dataIn, dataOut);
+
+    PASS();
+}
+
+TEST Queue_spsc_pop_wait_is_woken_by_a_push(void)
+{
+    /*****************    Arrange    *****************/
+    QueueSpsc_t q;
+    uint32_t buf[4];
+    uint32_t dataOut = 0;
+    pthread_t producer;
+    QueueSpsc_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    pthread_create(&producer, NULL, Queue_Spsc_Delayed_Producer, &q);
+    Queue_Error_e err = QueueSpsc_PopWait(&q, &dataOut, NULL);
+    pthread_join(producer, NULL);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error_None, err);
+    ASSERT_EQ(42, dataOut);
+
+    PASS();
+}
+
+TEST Queue_spsc_push_wait_is_woken_by_a_pop(void)
+{
+    /*****************    Arrange    *****************/
+    QueueSpsc_t q;
+    uint32_t buf[2];
+    uint32_t dataIn = 9;
+    struct timespec timeout = { .tv_sec = 5, .tv_nsec = 0 };
+    pthread_t consumer;
+    QueueSpsc_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    QueueSpsc_Push(&q, &dataIn);
+    QueueSpsc_Push(&q, &dataIn);
+
+    /*****************     Act       *****************/
+    pthread_create(&consumer, NULL, Queue_Spsc_Delayed_Consumer, &q);
+    Queue_Error_e err = QueueSpsc_PushWait(&q, &dataIn, &timeout);
+    pthread_join(consumer, NULL);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error_None, err);
+    ASSERT_EQ(true, QueueSpsc_IsFull(&q));
+
+    PASS();
+}
+
+TEST Queue_spsc_can_hand_off_between_threads_with_blocking_calls(void)
+{
+    /*****************    Arrange    *****************/
+    QueueSpsc_t q;
+    uint32_t buf[8];
+    pthread_t producer;
+    uint32_t mismatches = 0;
+    QueueSpsc_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    pthread_create(&producer, NULL, Queue_Spsc_Blocking_Producer, &q);
+    for (uint32_t i = 0; i < QUEUE_SPSC_THREADED_ELEMENTS; i++)
+    {
+        uint32_t dataOut;
+        QueueSpsc_PopWait(&q, &dataOut, NULL);
+        mismatches += (dataOut != i);
+    }
+    pthread_join(producer, NULL);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(0, mismatches);
+    ASSERT_EQ(true, QueueSpsc_IsEmpty(&q));
+
+    PASS();
+}
+
+SUITE(Queue_Spsc_Suite)
+{
+    /* Unit Tests */
+    RUN_TEST(Queue_spsc_init_fails_if_buffer_is_not_an_integer_multiple_of_data_size);
+    RUN_TEST(Queue_spsc_can_report_empty_and_full);
+    RUN_TEST(Queue_spsc_push_fails_if_overflow_and_pop_fails_if_underflow);
+    RUN_TEST(Queue_spsc_can_peek_and_pop_in_order_across_the_wrap);
+    RUN_TEST(Queue_spsc_pop_wait_times_out_on_an_empty_queue);
+    RUN_TEST(Queue_spsc_wait_with_a_past_deadline_behaves_like_a_try);
+
+    /* Integration Tests */
+    RUN_TEST(Queue_spsc_can_hand_off_between_a_producer_and_consumer_thread);
+    RUN_TEST(Queue_spsc_pop_wait_is_woken_by_a_push);
+    RUN_TEST(Queue_spsc_push_wait_is_woken_by_a_pop);
+    RUN_TEST(Queue_spsc_can_hand_off_between_threads_with_blocking_calls);
+}
+
+#endif /* QUEUE_SPSC_SUITE_INCLUDED */
@@ -112,6 +112,29 @@ TEST Queue_can_report_not_full(void)
     PASS();
 }
 
+TEST Queue_can_report_count(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint16_t buf[3];
+    uint16_t dataIn = 5;
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    size_t empty = Queue_Count(&q);
+    Queue_Push(&q, &dataIn);
+    Queue_Push(&q, &dataIn);
+    size_t partial = Queue_Count(&q);
+    Queue_Push(&q, &dataIn);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(0, empty);
+    ASSERT_EQ(2, partial);
+    ASSERT_EQ(3, Queue_Count(&q));
+
+    PASS();
+}
+
 TEST Queue_pop_fails_if_underflow(void)
 {
     /*****************    Arrange    *****************/
@@ -467,6 +490,475 @@ TEST Queue_can_partially_fill_and_empty_8_byte_data_multiple_times()
     PASS();
 }
 
+TEST Queue_push_n_stops_when_the_queue_is_full(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint32_t buf[4];
+    uint32_t dataIn[6] = { 1, 2, 3, 4, 5, 6 };
+    uint32_t dataOut[6] = { 0 };
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Queue_Push(&q, &dataIn[0]);
+
+    /*****************     Act       *****************/
+    size_t pushed = Queue_PushN(&q, &dataIn[1], 5);
+    size_t popped = Queue_PopN(&q, dataOut, ELEMENTS_IN(dataOut));
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(3, pushed);
+    ASSERT_EQ(4, popped);
+    ASSERT_MEM_EQ(dataIn, dataOut, 4 * sizeof(uint32_t));
+    ASSERT_EQ(true, Queue_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Queue_pop_n_fails_gracefully_if_underflow(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint16_t buf[4];
+    uint16_t dataOut[4];
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    size_t popped = Queue_PopN(&q, dataOut, ELEMENTS_IN(dataOut));
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(0, popped);
+    ASSERT_EQ(true, Queue_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Queue_push_n_and_pop_n_wrap_around_the_buffer(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint64_t buf[5];
+    uint64_t dataIn[3];
+    uint64_t dataOut[3];
+    uint64_t single;
+    size_t moved = 0;
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    for (uint64_t lap = 0; lap < 1000; lap++)
+    {
+        for (uint64_t i = 0; i < ELEMENTS_IN(dataIn); i++)
+        {
+            dataIn[i] = lap * 10 + i;
+        }
+        moved += Queue_PushN(&q, dataIn, ELEMENTS_IN(dataIn));
+        Queue_Pop(&q, &single);
+        moved += Queue_PopN(&q, dataOut, 2);
+
+        /*****************    Assert     *****************/
+        ASSERT_EQ(dataIn[0], single);
+        ASSERT_MEM_EQ(&dataIn[1], dataOut, 2 * sizeof(uint64_t));
+        ASSERT_EQ(true, Queue_IsEmpty(&q));
+    }
+    ASSERT_EQ(5000, moved);
+
+    PASS();
+}
+
+TEST Queue_pop_n_can_empty_a_full_queue(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint8_t buf[3];
+    uint8_t dataIn[3] = { 7, 8, 9 };
+    uint8_t dataOut[3] = { 0 };
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Queue_Push(&q, &dataIn[0]);
+    Queue_Pop(&q, &dataOut[0]);
+    Queue_PushN(&q, dataIn, 3);
+
+    /*****************     Act       *****************/
+    bool wasFull = Queue_IsFull(&q);
+    size_t popped = Queue_PopN(&q, dataOut, 3);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(true, wasFull);
+    ASSERT_EQ(3, popped);
+    ASSERT_MEM_EQ(dataIn, dataOut, sizeof(dataIn));
+    ASSERT_EQ(true, Queue_IsEmpty(&q));
+    ASSERT_EQ(false, Queue_IsFull(&q));
+
+    PASS();
+}
+
+TEST Queue_reserve_write_fails_if_full(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint8_t buf[2];
+    uint8_t dataIn = 5;
+    size_t numElems = 99;
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Queue_Push(&q, &dataIn);
+    Queue_Push(&q, &dataIn);
+
+    /*****************     Act       *****************/
+    void *pSlot = Queue_ReserveWrite(&q, &numElems);
+    Queue_Error_e err = Queue_CommitWrite(&q, 1);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(NULL, pSlot);
+    ASSERT_EQ(0, numElems);
+    ASSERT_EQ(Queue_Error, err);
+
+    PASS();
+}
+
+TEST Queue_can_build_elements_in_place_and_pop_them(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint32_t buf[4];
+    uint32_t dataOut[3];
+    size_t numElems;
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    uint32_t *pSlots = Queue_ReserveWrite(&q, &numElems);
+    pSlots[0] = 10;
+    pSlots[1] = 20;
+    pSlots[2] = 30;
+    Queue_Error_e err = Queue_CommitWrite(&q, 3);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(4, numElems);
+    ASSERT_EQ(Queue_Error_None, err);
+    ASSERT_EQ(3, Queue_PopN(&q, dataOut, ELEMENTS_IN(dataOut)));
+    ASSERT_EQ(10, dataOut[0]);
+    ASSERT_EQ(20, dataOut[1]);
+    ASSERT_EQ(30, dataOut[2]);
+    ASSERT_EQ(true, Queue_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Queue_reserve_write_leaves_an_empty_queue_unchanged(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint8_t buf[4];
+    uint8_t dataIn[] = { 1, 2, 3 };
+    size_t numElems;
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Queue_PushN(&q, dataIn, 2);
+    Queue_Release(&q, 2);
+
+    /*****************     Act       *****************/
+    uint8_t *pSlots = Queue_ReserveWrite(&q, &numElems);
+    Queue_Push(&q, &dataIn[2]);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(&buf[0], pSlots);
+    ASSERT_EQ(4, numElems);
+    ASSERT_EQ(&buf[2], Queue_PeekRef(&q, &numElems));
+    ASSERT_EQ(1, numElems);
+    ASSERT_EQ(3, buf[2]);
+
+    PASS();
+}
+
+TEST Queue_commit_write_on_an_empty_queue_starts_at_the_top(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint16_t buf[4];
+    uint16_t dataIn[] = { 1, 2, 3 };
+    uint16_t dataOut[4];
+    size_t numElems;
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Queue_PushN(&q, dataIn, 3);
+    Queue_Release(&q, 3);
+
+    /*****************     Act       *****************/
+    uint16_t *pSlots = Queue_ReserveWrite(&q, &numElems);
+    for (size_t i = 0; i < numElems; i++)
+    {
+        pSlots[i] = (uint16_t)(10 + i);
+    }
+    Queue_Error_e err = Queue_CommitWrite(&q, numElems);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error_None, err);
+    ASSERT_EQ(true, Queue_IsFull(&q));
+    ASSERT_EQ(4, Queue_PopN(&q, dataOut, ELEMENTS_IN(dataOut)));
+    ASSERT_EQ(10, dataOut[0]);
+    ASSERT_EQ(13, dataOut[3]);
+
+    PASS();
+}
+
+TEST Queue_peek_ref_returns_runs_that_stop_at_the_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint16_t buf[4];
+    uint16_t dataIn[] = { 1, 2, 3, 4, 5 };
+    size_t numElems;
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Queue_PushN(&q, dataIn, 3);
+    Queue_Release(&q, 2);
+    Queue_PushN(&q, &dataIn[3], 2);
+
+    /*****************     Act       *****************/
+    uint16_t *pFirst = Queue_PeekRef(&q, &numElems);
+    size_t firstRun = numElems;
+    Queue_Error_e err = Queue_Release(&q, firstRun);
+    uint16_t *pSecond = Queue_PeekRef(&q, &numElems);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error_None, err);
+    ASSERT_EQ(2, firstRun);
+    ASSERT_EQ(3, pFirst[0]);
+    ASSERT_EQ(4, pFirst[1]);
+    ASSERT_EQ(1, numElems);
+    ASSERT_EQ(5, pSecond[0]);
+    ASSERT_EQ(Queue_Error_None, Queue_Release(&q, 1));
+    ASSERT_EQ(NULL, Queue_PeekRef(&q, NULL));
+    ASSERT_EQ(true, Queue_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Queue_release_fails_if_underflow(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint8_t buf[4];
+    uint8_t dataIn = 5;
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Queue_Push(&q, &dataIn);
+
+    /*****************     Act       *****************/
+    Queue_Error_e err = Queue_Release(&q, 2);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, err);
+    ASSERT_EQ(false, Queue_IsEmpty(&q));
+
+    PASS();
+}
+
+typedef struct _Queue_Drain_Sum_t
+{
+    uint32_t sum;
+    uint32_t visited;
+    uint32_t stopAfter;
+} Queue_Drain_Sum_t;
+
+static bool Queue_Drain_Sum(void *pCtx, void *pElem)
+{
+    Queue_Drain_Sum_t *pSum = pCtx;
+
+    pSum->sum = pSum->sum * 10 + *(uint16_t *)pElem;
+
+    return (++pSum->visited != pSum->stopAfter);
+}
+
+TEST Queue_drain_visits_elements_in_order_across_the_wrap(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint16_t buf[4];
+    uint16_t dataIn[] = { 1, 2, 3, 4, 5 };
+    Queue_Drain_Sum_t sum = { 0 };
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Queue_PushN(&q, dataIn, 3);
+    Queue_Release(&q, 2);
+    Queue_PushN(&q, &dataIn[3], 2);
+
+    /*****************     Act       *****************/
+    size_t drained = Queue_Drain(&q, Queue_Drain_Sum, &sum, 10);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(3, drained);
+    ASSERT_EQ(345, sum.sum);
+    ASSERT_EQ(true, Queue_IsEmpty(&q));
+    ASSERT_EQ(0, Queue_Drain(&q, Queue_Drain_Sum, &sum, 10));
+
+    PASS();
+}
+
+TEST Queue_drain_stops_at_max_or_when_the_callback_says_so(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint16_t buf[6];
+    uint16_t dataIn[] = { 1, 2, 3, 4, 5, 6 };
+    uint16_t dataOut;
+    Queue_Drain_Sum_t first = { 0 };
+    Queue_Drain_Sum_t second = { .stopAfter = 2 };
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+    Queue_PushN(&q, dataIn, ELEMENTS_IN(dataIn));
+
+    /*****************     Act       *****************/
+    size_t firstDrained = Queue_Drain(&q, Queue_Drain_Sum, &first, 2);
+    size_t secondDrained = Queue_Drain(&q, Queue_Drain_Sum, &second, 10);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(2, firstDrained);
+    ASSERT_EQ(12, first.sum);
+    ASSERT_EQ(2, secondDrained);
+    ASSERT_EQ(34, second.sum);
+    ASSERT_EQ(2, Queue_Count(&q));
+    ASSERT_EQ(Queue_Error_None, Queue_Pop(&q, &dataOut));
+    ASSERT_EQ(5, dataOut);
+
+    PASS();
+}
+
+TEST Queue_overwrite_push_drops_the_oldest_element_when_full(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint8_t buf[3];
+    uint8_t dataOut[3];
+    Queue_InitEx(&q, buf, sizeof(buf), sizeof(buf[0]), Queue_Flag_Overwrite);
+
+    /*****************     Act       *****************/
+    Queue_Error_e err = Queue_Error_None;
+    for (uint8_t i = 1; i <= 5; i++)
+    {
+        err |= Queue_Push(&q, &i);
+    }
+    size_t popped = Queue_PopN(&q, dataOut, ELEMENTS_IN(dataOut));
+
+    /*****************    Assert     *****************/
+    uint8_t expected[] = { 3, 4, 5 };
+    ASSERT_EQ(Queue_Error_None, err);
+    ASSERT_EQ(3, popped);
+    ASSERT_MEM_EQ(expected, dataOut, sizeof(expected));
+    ASSERT_EQ(2, Queue_Overwritten(&q));
+    ASSERT_EQ(true, Queue_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Queue_overwrite_push_n_keeps_the_newest_elements(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint16_t buf[4];
+    uint16_t dataIn[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    uint16_t dataOut[4];
+    Queue_InitEx(&q, buf, sizeof(buf), sizeof(buf[0]), Queue_Flag_Overwrite);
+    Queue_PushN(&q, dataIn, 3);
+
+    /*****************     Act       *****************/
+    size_t pushedPartial = Queue_PushN(&q, &dataIn[3], 2);
+    size_t countPartial = Queue_Count(&q);
+    size_t pushedOversized = Queue_PushN(&q, &dataIn[2], 7);
+    size_t popped = Queue_PopN(&q, dataOut, ELEMENTS_IN(dataOut));
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(2, pushedPartial);
+    ASSERT_EQ(4, countPartial);
+    ASSERT_EQ(7, pushedOversized);
+    ASSERT_EQ(4, popped);
+    ASSERT_MEM_EQ(&dataIn[5], dataOut, sizeof(dataOut));
+    ASSERT_EQ(1 + 7, Queue_Overwritten(&q));
+
+    PASS();
+}
+
+#ifdef QUEUE_STATS
+TEST Queue_stats_count_traffic_rejections_and_occupancy(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint32_t buf[8];
+    uint32_t dataIn[8] = { 0 };
+    uint32_t dataOut[8];
+    Queue_Stats_t stats;
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    Queue_Pop(&q, dataOut);
+    Queue_Push(&q, &dataIn[0]);
+    Queue_Push(&q, &dataIn[0]);
+    Queue_Push(&q, &dataIn[0]);
+    Queue_PushN(&q, dataIn, 5);
+    Queue_Push(&q, &dataIn[0]);
+    Queue_PopN(&q, dataOut, 6);
+    Queue_Pop(&q, dataOut);
+    Queue_Error_e err = Queue_GetStats(&q, &stats);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error_None, err);
+    ASSERT_EQ(8, stats.pushes);
+    ASSERT_EQ(7, stats.pops);
+    ASSERT_EQ(1, stats.fullRejects);
+    ASSERT_EQ(1, stats.emptyRejects);
+    ASSERT_EQ(8, stats.highWater);
+    ASSERT_EQ(1, stats.occupancy[0]); /* 1 queued */
+    ASSERT_EQ(2, stats.occupancy[1]); /* 2 and 3 queued */
+    ASSERT_EQ(0, stats.occupancy[2]);
+    ASSERT_EQ(1, stats.occupancy[3]); /* 8 queued after the PushN */
+
+    PASS();
+}
+#else
+TEST Queue_stats_are_unavailable_without_queue_stats(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_t q;
+    uint32_t buf[8];
+    Queue_Stats_t stats;
+    Queue_Init(&q, buf, sizeof(buf), sizeof(buf[0]));
+
+    /*****************     Act       *****************/
+    Queue_Error_e err = Queue_GetStats(&q, &stats);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, err);
+
+    PASS();
+}
+#endif
+
+TEST Queue_can_push_and_pop_every_specialized_data_size(void)
+{
+    /*****************    Arrange    *****************/
+    const size_t sizes[] = { 1, 2, 3, 4, 8, 16, 24, 32, 48, 64, 96, 100 };
+    _Alignas(32) uint8_t buf[3 * 100];
+    uint8_t dataIn[100];
+    uint8_t dataOut[100];
+    uint8_t peekData[100];
+
+    for (size_t s = 0; s < ELEMENTS_IN(sizes); s++)
+    {
+        Queue_t q;
+        size_t dataSize = sizes[s];
+        Queue_Init(&q, buf, 3 * dataSize, dataSize);
+
+        /*****************     Act       *****************/
+        for (size_t i = 0; i < 10; i++)
+        {
+            for (size_t byte = 0; byte < dataSize; byte++)
+            {
+                dataIn[byte] = (uint8_t)(i * 31 + byte);
+            }
+            Queue_Push(&q, dataIn);
+            Queue_Peek(&q, peekData);
+            Queue_Pop(&q, dataOut);
+
+            /*****************    Assert     *****************/
+            ASSERT_MEM_EQ(dataIn, peekData, dataSize);
+            ASSERT_MEM_EQ(dataIn, dataOut, dataSize);
+            ASSERT_EQ(true, Queue_IsEmpty(&q));
+        }
+    }
+
+    PASS();
+}
+
 SUITE(Queue_Suite)
 {
     /* Unit Tests */
@@ -476,6 +968,7 @@ SUITE(Queue_Suite)
     RUN_TEST(Queue_can_report_not_empty);
     RUN_TEST(Queue_can_report_full);
     RUN_TEST(Queue_can_report_not_full);
+    RUN_TEST(Queue_can_report_count);
     RUN_TEST(Queue_pop_fails_if_underflow);
     RUN_TEST(Queue_push_fails_if_overflow);
     RUN_TEST(Queue_can_pop_1_byte_data_types);
@@ -483,6 +976,25 @@ SUITE(Queue_Suite)
     RUN_TEST(Queue_can_pop_8_byte_data_types);
     RUN_TEST(Queue_can_pop_a_struct_data_type);
     RUN_TEST(Queue_can_peek_at_next_element_to_be_popped);
+    RUN_TEST(Queue_can_push_and_pop_every_specialized_data_size);
+    RUN_TEST(Queue_push_n_stops_when_the_queue_is_full);
+    RUN_TEST(Queue_pop_n_fails_gracefully_if_underflow);
+    RUN_TEST(Queue_pop_n_can_empty_a_full_queue);
+    RUN_TEST(Queue_reserve_write_fails_if_full);
+    RUN_TEST(Queue_can_build_elements_in_place_and_pop_them);
+    RUN_TEST(Queue_reserve_write_leaves_an_empty_queue_unchanged);
+    RUN_TEST(Queue_commit_write_on_an_empty_queue_starts_at_the_top);
+    RUN_TEST(Queue_peek_ref_returns_runs_that_stop_at_the_wrap);
+    RUN_TEST(Queue_release_fails_if_underflow);
+    RUN_TEST(Queue_drain_visits_elements_in_order_across_the_wrap);
+    RUN_TEST(Queue_drain_stops_at_max_or_when_the_callback_says_so);
+    RUN_TEST(Queue_overwrite_push_drops_the_oldest_element_when_full);
+    RUN_TEST(Queue_overwrite_push_n_keeps_the_newest_elements);
+#ifdef QUEUE_STATS
+    RUN_TEST(Queue_stats_count_traffic_rejections_and_occupancy);
+#else
+    RUN_TEST(Queue_stats_are_unavailable_without_queue_stats);
+#endif
 
     /* Integration Tests */
     RUN_TEST(Queue_can_fill_and_empty_a_large_buffer_with_1_byte_data_types);
@@ -490,6 +1002,7 @@ SUITE(Queue_Suite)
     RUN_TEST(Queue_can_fill_and_empty_a_large_buffer_with_struct_data_types);
     RUN_TEST(Queue_can_partially_fill_and_empty_1_byte_data_multiple_times);
     RUN_TEST(Queue_can_partially_fill_and_empty_8_byte_data_multiple_times);
+    RUN_TEST(Queue_push_n_and_pop_n_wrap_around_the_buffer);
 }
 
 #endif /* QUEUE_SUITE_INCLUDED */
\ No newline at end of file
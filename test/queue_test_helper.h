@@ -1,8 +1,19 @@
 #ifndef QUEUE_TEST_HELPER_H_INCLUDED
 #define QUEUE_TEST_HELPER_H_INCLUDED
 
+#include <stdint.h>
 #include <stdlib.h>
+#include <time.h>
 
 #define ELEMENTS_IN(array)    ( sizeof(array) / sizeof(array[0]) )
 
+/* Monotonic nanoseconds elapsed since pStart */
+static inline int64_t Queue_ElapsedNs(const struct timespec *pStart)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (int64_t)(now.tv_sec - pStart->tv_sec) * 1000000000 + (now.tv_nsec - pStart->tv_nsec);
+}
+
 #endif /* QUEUE_TEST_HELPER_H_INCLUDED */
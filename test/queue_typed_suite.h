@@ -0,0 +1,121 @@
+#ifndef QUEUE_TYPED_SUITE_INCLUDED
+#define QUEUE_TYPED_SUITE_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "greatest.h"
+#include "queue_test_helper.h"
+#include "queue_typed.h"
+
+/* No padding, so records can be compared with ASSERT_MEM_EQ */
+typedef struct _Queue_Typed_Record_t
+{
+    uint32_t a;
+    uint16_t b;
+    uint16_t c;
+    uint64_t d;
+} Queue_Typed_Record_t;
+
+QUEUE_DEFINE(Queue_Typed_U8, uint8_t, 2)
+QUEUE_DEFINE(Queue_Typed_Records, Queue_Typed_Record_t, 5)
+
+/* Declare a local suite. */
+SUITE(Queue_Typed_Suite);
+
+TEST Queue_typed_can_report_empty_full_and_count(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_Typed_U8_t q;
+    uint8_t dataIn = 5;
+    Queue_Error_e err = Queue_Typed_U8_Init(&q);
+
+    /*****************     Act       *****************/
+    bool wasEmpty = Queue_Typed_U8_IsEmpty(&q);
+    Queue_Typed_U8_Push(&q, &dataIn);
+    size_t partial = Queue_Typed_U8_Count(&q);
+    Queue_Typed_U8_Push(&q, &dataIn);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error_None, err);
+    ASSERT_EQ(true, wasEmpty);
+    ASSERT_EQ(1, partial);
+    ASSERT_EQ(true, Queue_Typed_U8_IsFull(&q));
+    ASSERT_EQ(false, Queue_Typed_U8_IsEmpty(&q));
+
+    PASS();
+}
+
+TEST Queue_typed_push_fails_if_overflow_and_pop_fails_if_underflow(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_Typed_U8_t q;
+    uint8_t dataIn = 5;
+    uint8_t dataOut;
+    Queue_Typed_U8_Init(&q);
+
+    /*****************     Act       *****************/
+    Queue_Error_e popErr = Queue_Typed_U8_Pop(&q, &dataOut);
+    Queue_Error_e peekErr = Queue_Typed_U8_Peek(&q, &dataOut);
+    Queue_Typed_U8_Push(&q, &dataIn);
+    Queue_Typed_U8_Push(&q, &dataIn);
+    Queue_Error_e pushErr = Queue_Typed_U8_Push(&q, &dataIn);
+
+    /*****************    Assert     *****************/
+    ASSERT_EQ(Queue_Error, popErr);
+    ASSERT_EQ(Queue_Error, peekErr);
+    ASSERT_EQ(Queue_Error, pushErr);
+
+    PASS();
+}
+
+TEST Queue_typed_can_partially_fill_and_empty_structs_multiple_times(void)
+{
+    /*****************    Arrange    *****************/
+    Queue_Typed_Records_t q;
+    Queue_Typed_Record_t peekData;
+    Queue_Typed_Record_t dataOut[3];
+    uint8_t err = (uint8_t)Queue_Error_None;
+    Queue_Typed_Records_Init(&q);
+
+    /*****************     Act       *****************/
+    for (uint32_t i = 0; i < 10000; i++)
+    {
+        Queue_Typed_Record_t dataIn[3] =
+        {
+            { .a = i,     .b = 1, .c = (uint16_t)i, .d = ~(uint64_t)i },
+            { .a = i * 2, .b = 3, .c = 4,           .d = 5          },
+            { .a = i * 3, .b = 6, .c = 7,           .d = i          },
+        };
+        for (uint32_t j = 0; j < ELEMENTS_IN(dataIn); j++)
+        {
+            err |= Queue_Typed_Records_Push(&q, &dataIn[j]);
+        }
+        err |= Queue_Typed_Records_Peek(&q, &peekData);
+        for (uint32_t j = 0; j < ELEMENTS_IN(dataOut); j++)
+        {
+            err |= Queue_Typed_Records_Pop(&q, &dataOut[j]);
+        }
+
+        /*****************    Assert     *****************/
+        ASSERT_EQ(Queue_Error_None, (Queue_Error_e)err);
+        ASSERT_MEM_EQ(&dataIn[0], &peekData, sizeof(peekData));
+        ASSERT_MEM_EQ(dataIn, dataOut, sizeof(dataIn));
+        ASSERT_EQ(true, Queue_Typed_Records_IsEmpty(&q));
+    }
+
+    PASS();
+}
+
+SUITE(Queue_Typed_Suite)
+{
+    /* Unit Tests */
+    RUN_TEST(Queue_typed_can_report_empty_full_and_count);
+    RUN_TEST(Queue_typed_push_fails_if_overflow_and_pop_fails_if_underflow);
+
+    /* Integration Tests */
+    RUN_TEST(Queue_typed_can_partially_fill_and_empty_structs_multiple_times);
+}
+
+#endif /* QUEUE_TYPED_SUITE_INCLUDED */